@@ -0,0 +1,303 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Cook.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include <Rebirth.h>
+#include <rebirth/renderer/CookedTexture.h>
+#include <rebirth/scene/SceneSerializer.h>
+#include <platform/opengl/OpenGLShaderPack.h>
+#include <platform/opengl/OpenGLShaderCache.h>
+
+#include "CookDatabase.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+// Cooks every asset under the asset directory into what the runtime loads in its place. Run it from the project directory:
+//   Rebirth-Cook [-f] [--uncompressed] [-j <threads>] [asset directory]
+// The directory defaults to assets. Images are cooked to <image>.rbtex, scenes to <scene>.rbscene and all
+// shaders into assets/shaders.rbpack. What each asset was cooked from is kept in <assets>/cache/cook.yaml, and
+// only assets whose inputs or settings changed since are cooked again, spread over every core. -f cooks everything
+
+using namespace rebirth;
+
+enum class AssetType
+{
+	TEXTURE,
+	SHADERS,
+	SCENE
+};
+
+struct Asset
+{
+	std::string name;
+	AssetType type;
+	std::vector<std::string> inputs;
+	std::vector<std::string> outputs;
+};
+
+struct CookOptions
+{
+	bool force = false;
+	bool compress = true;
+};
+
+enum class CookStatus
+{
+	UP_TO_DATE,
+	COOKED,
+	FAILED
+};
+
+struct CookResult
+{
+	CookStatus status = CookStatus::FAILED;
+	CookRecord record;
+};
+
+static const char* TypeToString(const AssetType type)
+{
+	switch (type)
+	{
+		case AssetType::TEXTURE: return "texture";
+		case AssetType::SHADERS: return "shaders";
+		case AssetType::SCENE: return "scene";
+	}
+	return "unknown";
+}
+
+static bool IsImage(const std::string& extension)
+{
+	return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+}
+
+static bool IsShader(const std::string& extension)
+{
+	return extension == ".glsl" || extension == ".vert" || extension == ".frag";
+}
+
+// Sources under the directory, the shaders first since they're one big job that should start early
+static std::vector<Asset> FindAssets(const std::filesystem::path& directory)
+{
+	std::vector<Asset> assets;
+	Asset shaders = { OpenGLShaderPack::DEFAULT_PATH, AssetType::SHADERS, {}, { OpenGLShaderPack::DEFAULT_PATH } };
+
+	const std::filesystem::path cache = directory / "cache";
+	for (auto it = std::filesystem::recursive_directory_iterator(directory); it != std::filesystem::recursive_directory_iterator(); ++it)
+	{
+		if (it->is_directory() && it->path() == cache)
+		{
+			it.disable_recursion_pending();
+			continue;
+		}
+		if (!it->is_regular_file())
+			continue;
+
+		std::string path = it->path().generic_string();
+		std::string extension = it->path().extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower(c); });
+
+		if (IsImage(extension))
+			assets.push_back({ path, AssetType::TEXTURE, { path }, { CookedTexture::GetCookedPath(path) } });
+		else if (extension == ".rebirth")
+			assets.push_back({ path, AssetType::SCENE, { path }, { SceneSerializer::GetCookedPath(path) } });
+		else if (IsShader(extension))
+			shaders.inputs.push_back(path);
+	}
+
+	std::sort(assets.begin(), assets.end(), [](const Asset& a, const Asset& b) { return a.name < b.name; });
+	if (!shaders.inputs.empty())
+	{
+		std::sort(shaders.inputs.begin(), shaders.inputs.end());
+		assets.insert(assets.begin(), std::move(shaders));
+	}
+	return assets;
+}
+
+static CookResult CookAsset(const Asset& asset, const CookDatabase& database, const CookOptions& options)
+{
+	CookResult result;
+	result.record.outputs = asset.outputs;
+
+	// The output format's version is part of the key, so bumping one recooks everything written with the old one
+	ShaderHasher key;
+	key.Add(asset.type);
+	switch (asset.type)
+	{
+		case AssetType::TEXTURE:
+			key.Add(CookedTexture::VERSION);
+			key.Add(options.compress);
+			break;
+		case AssetType::SHADERS: key.Add(OpenGLShaderPack::VERSION); break;
+		case AssetType::SCENE: key.Add(SceneSerializer::BINARY_VERSION); break;
+	}
+
+	for (const auto& path : asset.inputs)
+	{
+		CookInput input;
+		if (!database.ReadInput(asset.name, path, input))
+		{
+			RB_CLIENT_ERROR("Failed to read {}", path);
+			return result;
+		}
+
+		key.Add(input.path);
+		key.Add(input.hash);
+		result.record.inputs.push_back(std::move(input));
+	}
+	result.record.key = key.Get();
+
+	const CookRecord* previous = database.Find(asset.name);
+	bool upToDate = !options.force && previous && previous->key == result.record.key;
+	for (const auto& output : asset.outputs)
+		upToDate &= std::filesystem::exists(output);
+
+	if (upToDate)
+	{
+		result.status = CookStatus::UP_TO_DATE;
+		return result;
+	}
+
+	bool cooked = false;
+	switch (asset.type)
+	{
+		case AssetType::TEXTURE: cooked = CookedTexture::Cook(asset.inputs[0], asset.outputs[0], options.compress); break;
+		case AssetType::SHADERS: cooked = OpenGLShaderPack::Cook(asset.inputs, asset.outputs[0]); break;
+		case AssetType::SCENE: cooked = SceneSerializer::Cook(asset.inputs[0], asset.outputs[0]); break;
+	}
+
+	result.status = cooked ? CookStatus::COOKED : CookStatus::FAILED;
+	return result;
+}
+
+static void PrintUsage()
+{
+	RB_CLIENT_INFO("Usage: Rebirth-Cook [-f] [--uncompressed] [-j <threads>] [asset directory]");
+}
+
+int main(int argc, char** argv)
+{
+	Log::Init();
+
+	CookOptions options;
+	std::string directory = "assets";
+	uint32 threadCount = std::max(1u, std::thread::hardware_concurrency());
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-f" || arg == "--force")
+			options.force = true;
+		else if (arg == "--uncompressed")
+			options.compress = false;
+		else if ((arg == "-j" || arg == "--jobs") && i + 1 < argc)
+			threadCount = std::max(1, std::atoi(argv[++i]));
+		else if (arg == "-h" || arg == "--help")
+		{
+			PrintUsage();
+			return 0;
+		}
+		else
+			directory = arg;
+	}
+
+	if (!std::filesystem::is_directory(directory))
+	{
+		RB_CLIENT_ERROR("{} is not a directory", directory);
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	const std::string databasePath = (std::filesystem::path(directory) / "cache" / "cook.yaml").generic_string();
+	CookDatabase database;
+	database.Load(databasePath);
+
+	std::vector<Asset> assets = FindAssets(directory);
+
+	// One asset per job so a slow one doesn't hold up a batch, the database is only read meanwhile.
+	// The main thread cooks as well, with -j 1 everything runs on it
+	std::vector<CookResult> results(assets.size());
+	if (threadCount > 1)
+		JobSystem::Init(threadCount - 1);
+	JobSystem::ParallelFor("CookAsset", (uint32)assets.size(), 1, [&](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; i++)
+				results[i] = CookAsset(assets[i], database, options);
+		});
+	JobSystem::Shutdown();
+
+	uint32 cooked = 0;
+	uint32 upToDate = 0;
+	uint32 failed = 0;
+	std::unordered_set<std::string> current;
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		const Asset& asset = assets[i];
+		CookResult& result = results[i];
+		current.insert(asset.name);
+		switch (result.status)
+		{
+			case CookStatus::UP_TO_DATE:
+				// Keeps write times that changed without the contents, so they aren't hashed again
+				database.Set(asset.name, std::move(result.record));
+				upToDate++;
+				break;
+			case CookStatus::COOKED:
+				RB_CLIENT_INFO("Cooked {} {}", TypeToString(asset.type), asset.name);
+				database.Set(asset.name, std::move(result.record));
+				cooked++;
+				break;
+			case CookStatus::FAILED:
+				// Dropped so the next run tries again even if nothing changes
+				RB_CLIENT_ERROR("Failed to cook {} {}", TypeToString(asset.type), asset.name);
+				database.Remove(asset.name);
+				failed++;
+				break;
+		}
+	}
+
+	// Sources that were deleted take their cooked files with them, those would otherwise load in their place
+	uint32 removed = 0;
+	std::vector<std::string> stale;
+	for (auto&& [name, record] : database.GetRecords())
+	{
+		if (!current.count(name) && (record.inputs.empty() || !std::filesystem::exists(record.inputs[0].path)))
+			stale.push_back(name);
+	}
+	for (const auto& name : stale)
+	{
+		for (const auto& output : database.Find(name)->outputs)
+		{
+			std::error_code error;
+			if (std::filesystem::remove(output, error))
+				RB_CLIENT_INFO("Removed {}, its source is gone", output);
+		}
+		database.Remove(name);
+		removed++;
+	}
+
+	if (!database.Save(databasePath))
+		RB_CLIENT_ERROR("Failed to write the cook database {}", databasePath);
+
+	float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	RB_CLIENT_INFO("Cooked {} assets, {} up to date, {} failed, {} removed in {:.2f}s on {} threads", cooked, upToDate, failed, removed, seconds, threadCount);
+	return failed ? 1 : 0;
+}
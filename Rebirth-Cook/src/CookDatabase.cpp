@@ -0,0 +1,180 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: CookDatabase.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include <Rebirth.h>
+#include <platform/opengl/OpenGLShaderCache.h>
+
+#include "CookDatabase.h"
+
+#define YAML_CPP_STATIC_DEFINE
+#include <yaml-cpp/yaml.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace rebirth;
+
+// Bump whenever the records or how their keys are made change, so everything is cooked again.
+// A new output format only needs its own version bumped, those are part of each key
+static constexpr uint32 sDatabaseVersion = 2;
+
+static std::string KeyToString(const uint64 key)
+{
+	return fmt::format("{:016x}", key);
+}
+
+static uint64 KeyFromString(const std::string& str)
+{
+	return std::stoull(str, nullptr, 16);
+}
+
+void CookDatabase::Load(const std::string& filepath)
+{
+	mRecords.clear();
+
+	std::ifstream stream(filepath);
+	if (!stream)
+		return;
+
+	try {
+		YAML::Node data = YAML::Load(stream);
+		if (!data["Version"] || data["Version"].as<uint32>() != sDatabaseVersion)
+			return;
+
+		for (auto node : data["Assets"])
+		{
+			CookRecord record;
+			record.key = KeyFromString(node["Key"].as<std::string>());
+			for (auto input : node["Inputs"])
+			{
+				CookInput cookInput;
+				cookInput.path = input["Path"].as<std::string>();
+				cookInput.size = input["Size"].as<uint64>();
+				cookInput.time = input["Time"].as<int64>();
+				cookInput.hash = KeyFromString(input["Hash"].as<std::string>());
+				record.inputs.push_back(std::move(cookInput));
+			}
+			for (auto output : node["Outputs"])
+				record.outputs.push_back(output.as<std::string>());
+
+			mRecords[node["Asset"].as<std::string>()] = std::move(record);
+		}
+	}
+	catch (YAML::Exception e)
+	{
+		RB_CLIENT_WARN("Cook database {} is corrupt, cooking everything", filepath);
+		mRecords.clear();
+	}
+}
+
+bool CookDatabase::Save(const std::string& filepath) const
+{
+	YAML::Emitter out;
+	out << YAML::BeginMap;
+	out << YAML::Key << "Version" << YAML::Value << sDatabaseVersion;
+	out << YAML::Key << "Assets" << YAML::Value << YAML::BeginSeq;
+	for (auto&& [asset, record] : mRecords)
+	{
+		out << YAML::BeginMap;
+		out << YAML::Key << "Asset" << YAML::Value << asset;
+		out << YAML::Key << "Key" << YAML::Value << KeyToString(record.key);
+
+		out << YAML::Key << "Inputs" << YAML::Value << YAML::BeginSeq;
+		for (const auto& input : record.inputs)
+		{
+			out << YAML::BeginMap;
+			out << YAML::Key << "Path" << YAML::Value << input.path;
+			out << YAML::Key << "Size" << YAML::Value << input.size;
+			out << YAML::Key << "Time" << YAML::Value << input.time;
+			out << YAML::Key << "Hash" << YAML::Value << KeyToString(input.hash);
+			out << YAML::EndMap;
+		}
+		out << YAML::EndSeq;
+
+		out << YAML::Key << "Outputs" << YAML::Value << YAML::Flow << record.outputs;
+		out << YAML::EndMap;
+	}
+	out << YAML::EndSeq;
+	out << YAML::EndMap;
+
+	std::error_code error;
+	std::filesystem::create_directories(std::filesystem::path(filepath).parent_path(), error);
+
+	std::ofstream fout(filepath);
+	fout << out.c_str();
+	return fout.good();
+}
+
+const CookRecord* CookDatabase::Find(const std::string& asset) const
+{
+	auto it = mRecords.find(asset);
+	return it != mRecords.end() ? &it->second : nullptr;
+}
+
+void CookDatabase::Set(const std::string& asset, CookRecord record)
+{
+	mRecords[asset] = std::move(record);
+}
+
+void CookDatabase::Remove(const std::string& asset)
+{
+	mRecords.erase(asset);
+}
+
+bool CookDatabase::ReadInput(const std::string& asset, const std::string& path, CookInput& outInput) const
+{
+	std::error_code error;
+	outInput.path = path;
+	outInput.size = std::filesystem::file_size(path, error);
+	if (error)
+		return false;
+	outInput.time = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+	if (error)
+		return false;
+
+	// Unchanged size and time are trusted, so an up to date project is checked without reading a file
+	if (const CookRecord* record = Find(asset))
+	{
+		for (const auto& input : record->inputs)
+		{
+			if (input.path == path && input.size == outInput.size && input.time == outInput.time)
+			{
+				outInput.hash = input.hash;
+				return true;
+			}
+		}
+	}
+
+	std::ifstream in(path, std::ios::in | std::ios::binary);
+	if (!in)
+		return false;
+
+	ShaderHasher hasher;
+	std::vector<char> buffer(64 * 1024);
+	while (in)
+	{
+		in.read(buffer.data(), buffer.size());
+		hasher.Add(buffer.data(), (size_t)in.gcount());
+	}
+	outInput.hash = hasher.Get();
+	return true;
+}
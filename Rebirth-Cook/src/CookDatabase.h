@@ -0,0 +1,68 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: CookDatabase.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include <rebirth/core/Common.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// A file an asset was cooked from, as it was at the time
+struct CookInput
+{
+	std::string path;
+	rebirth::uint64 size = 0;
+	rebirth::int64 time = 0; // last write time, in the file clock's ticks
+	rebirth::uint64 hash = 0; // of the contents
+};
+
+struct CookRecord
+{
+	rebirth::uint64 key = 0; // hashes the cooker, its settings and every input
+	std::vector<CookInput> inputs;
+	std::vector<std::string> outputs;
+};
+
+// What every asset was last cooked from, kept in <assets>/cache/cook.yaml between runs.
+// Only read while assets cook in parallel, records are replaced afterwards on the main thread
+class CookDatabase
+{
+public:
+	// Starts empty if the file is missing, corrupt or was written by another version
+	void Load(const std::string& filepath);
+	bool Save(const std::string& filepath) const;
+
+	const CookRecord* Find(const std::string& asset) const;
+	void Set(const std::string& asset, CookRecord record);
+	void Remove(const std::string& asset);
+
+	const std::map<std::string, CookRecord>& GetRecords() const { return mRecords; }
+
+	// Hashes the file, unless the asset's record has it with the same size and write time.
+	// False if the file can't be read
+	bool ReadInput(const std::string& asset, const std::string& path, CookInput& outInput) const;
+
+private:
+	std::map<std::string, CookRecord> mRecords; // sorted so the file diffs cleanly
+};
@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: AssetPack.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include <Rebirth.h>
+#include <rebirth/core/Pack.h>
+
+#include <filesystem>
+
+// Packs asset directories into the archive the engine mounts at startup. Run it from the project directory:
+//   Rebirth-Pack [-o <pack>] [--uncompressed] <asset directory>...
+// Files are keyed by their path relative to the project directory, the same paths the loaders are given.
+// Entries are LZ4 compressed where that makes them smaller. The pack defaults to assets.rbpak
+
+using rebirth::Pack;
+using rebirth::PackFile;
+
+static void PrintUsage()
+{
+	RB_CLIENT_INFO("Usage: Rebirth-Pack [-o <pack>] [--uncompressed] <asset directory>...");
+}
+
+int main(int argc, char** argv)
+{
+	rebirth::Log::Init();
+
+	std::string output = Pack::DEFAULT_PATH;
+	bool compress = true;
+	std::vector<std::string> directories;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if ((arg == "-o" || arg == "--output") && i + 1 < argc)
+			output = argv[++i];
+		else if (arg == "--uncompressed")
+			compress = false;
+		else if (arg == "-h" || arg == "--help")
+		{
+			PrintUsage();
+			return 0;
+		}
+		else
+			directories.push_back(arg);
+	}
+
+	if (directories.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<PackFile> files;
+	uint64_t sourceBytes = 0;
+	for (const auto& directory : directories)
+	{
+		if (!std::filesystem::is_directory(directory))
+		{
+			RB_CLIENT_ERROR("{} is not a directory", directory);
+			return 1;
+		}
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			// Never pack a previous pack
+			std::error_code error;
+			if (std::filesystem::equivalent(entry.path(), output, error))
+				continue;
+
+			std::string path = entry.path().generic_string();
+			files.push_back({ path, path, compress });
+			sourceBytes += entry.file_size();
+		}
+	}
+	std::sort(files.begin(), files.end(), [](const PackFile& a, const PackFile& b) { return a.path < b.path; });
+
+	if (!Pack::Write(output, files))
+	{
+		RB_CLIENT_ERROR("Failed to write {}", output);
+		return 1;
+	}
+
+	RB_CLIENT_INFO("Packed {} files, {} bytes to {} bytes in {}", files.size(), sourceBytes, std::filesystem::file_size(output), output);
+	return 0;
+}
@@ -2,7 +2,7 @@
 #version 450 core
 
 layout(location=0) in vec3 aWorldPos;
-layout(location=1) in vec3 aLocalPos;
+layout(location=1) in vec2 aLocalPos;
 layout(location=2) in vec4 aColor;
 layout(location=3) in float aThickness;
 layout(location=4) in float aFade;
@@ -29,7 +29,7 @@ layout(location = 4) out flat int vEntityID;
 	
 void main()
 {
-	Output.localPos = aLocalPos;
+	Output.localPos = vec3(aLocalPos, 0.0);
 	Output.color = aColor;
 	Output.thickness = aThickness;
 	Output.fade = aFade;
@@ -1,10 +1,16 @@
+// Cooked by Rebirth-ShaderCook besides the default, keep in step with QUAD_VARIANT_SLOTS in Renderer2D.cpp
+#variant TEXTURE_SLOTS=1
+#variant TEXTURE_SLOTS=2
+#variant TEXTURE_SLOTS=8
+#variant TEXTURE_SLOTS=32
+
 #type vertex
 #version 450 core
 
 layout(location=0) in vec3 aPos;
 layout(location=1) in vec4 aColor;
 layout(location=2) in vec2 aTexCoord;
-layout(location=3) in float aTexIndex;
+layout(location=3) in uint aTexIndex;
 layout(location=4) in float aTilingFactor;
 layout(location=5) in int aEntityID;
 
@@ -32,7 +38,7 @@ void main()
 {
 	Output.texCoord = aTexCoord * aTilingFactor;
 	Output.color = aColor;
-	vTexIndex = aTexIndex;
+	vTexIndex = float(aTexIndex);
 	vEntityID = aEntityID;
 	gl_Position = uViewProj * vec4(aPos, 1.0);
 }
@@ -53,15 +59,26 @@ layout(location = 0) in VertexOutput Input;
 layout(location = 2) in flat float vTexIndex;
 layout(location = 3) in flat int vEntityID;
 
-layout(binding = 0) uniform sampler2D uTextures[32];
+// Renderer2D picks a variant by how many slots the batch binds, slot 0 is always white
+#ifndef TEXTURE_SLOTS
+	#define TEXTURE_SLOTS 32
+#endif
+
+#if TEXTURE_SLOTS > 1
+layout(binding = 0) uniform sampler2D uTextures[TEXTURE_SLOTS];
+#endif
 
 void main()
 {
 	vec4 texColor = Input.color;
 
+#if TEXTURE_SLOTS == 2
+	if (int(vTexIndex) == 1)
+		texColor *= texture(uTextures[1], Input.texCoord);
+#elif TEXTURE_SLOTS > 2
 	switch(int(vTexIndex))
 	{
-		case  0: texColor *= texture(uTextures[ 0], Input.texCoord); break;
+		case  0: break;
 		case  1: texColor *= texture(uTextures[ 1], Input.texCoord); break;
 		case  2: texColor *= texture(uTextures[ 2], Input.texCoord); break;
 		case  3: texColor *= texture(uTextures[ 3], Input.texCoord); break;
@@ -69,6 +86,7 @@ void main()
 		case  5: texColor *= texture(uTextures[ 5], Input.texCoord); break;
 		case  6: texColor *= texture(uTextures[ 6], Input.texCoord); break;
 		case  7: texColor *= texture(uTextures[ 7], Input.texCoord); break;
+#if TEXTURE_SLOTS > 8
 		case  8: texColor *= texture(uTextures[ 8], Input.texCoord); break;
 		case  9: texColor *= texture(uTextures[ 9], Input.texCoord); break;
 		case 10: texColor *= texture(uTextures[10], Input.texCoord); break;
@@ -93,7 +111,9 @@ void main()
 		case 29: texColor *= texture(uTextures[29], Input.texCoord); break;
 		case 30: texColor *= texture(uTextures[30], Input.texCoord); break;
 		case 31: texColor *= texture(uTextures[31], Input.texCoord); break;
+#endif
 	}
+#endif
 	color = texColor;
 	color2 = vEntityID;
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+// Cooked by Rebirth-ShaderCook besides the default, keep in step with QUAD_VARIANT_SLOTS in Renderer2D.cpp
+#variant TEXTURE_SLOTS=1
+#variant TEXTURE_SLOTS=2
+#variant TEXTURE_SLOTS=8
+#variant TEXTURE_SLOTS=32
+
+#type vertex
+#version 450 core
+
+// Per instance, see QuadInstance in Renderer2D.cpp
+layout(location=0) in vec3 aAxisX;
+layout(location=1) in vec3 aAxisY;
+layout(location=2) in vec3 aTranslation;
+layout(location=3) in vec4 aColor;
+layout(location=4) in vec2 aTexMin;
+layout(location=5) in vec2 aTexMax;
+layout(location=6) in uint aTexIndex;
+layout(location=7) in float aTilingFactor;
+layout(location=8) in int aEntityID;
+
+layout(std140, binding = 0) uniform Camera
+{
+	mat4 uViewProj;
+};
+
+struct VertexOutput
+{
+	vec4 color;
+	vec2 texCoord;
+};
+
+
+
+layout(location = 0) out VertexOutput Output;
+layout(location = 2) out flat float vTexIndex;
+layout(location = 3) out flat int vEntityID;
+
+// Indexed by the 0, 1, 2, 2, 3, 0 index buffer
+const vec2 cCorners[4] = vec2[](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+const vec2 cTexCoords[4] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+void main()
+{
+	vec2 corner = cCorners[gl_VertexID];
+	vec3 pos = aTranslation + aAxisX * corner.x + aAxisY * corner.y;
+
+	Output.texCoord = mix(aTexMin, aTexMax, cTexCoords[gl_VertexID]) * aTilingFactor;
+	Output.color = aColor;
+	vTexIndex = float(aTexIndex);
+	vEntityID = aEntityID;
+	gl_Position = uViewProj * vec4(pos, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location=0) out vec4 color;
+layout(location=1) out int color2;
+
+struct VertexOutput
+{
+	vec4 color;
+	vec2 texCoord;
+};
+
+layout(location = 0) in VertexOutput Input;
+layout(location = 2) in flat float vTexIndex;
+layout(location = 3) in flat int vEntityID;
+
+// Renderer2D picks a variant by how many slots the batch binds, slot 0 is always white
+#ifndef TEXTURE_SLOTS
+	#define TEXTURE_SLOTS 32
+#endif
+
+#if TEXTURE_SLOTS > 1
+layout(binding = 0) uniform sampler2D uTextures[TEXTURE_SLOTS];
+#endif
+
+void main()
+{
+	vec4 texColor = Input.color;
+
+#if TEXTURE_SLOTS == 2
+	if (int(vTexIndex) == 1)
+		texColor *= texture(uTextures[1], Input.texCoord);
+#elif TEXTURE_SLOTS > 2
+	switch(int(vTexIndex))
+	{
+		case  0: break;
+		case  1: texColor *= texture(uTextures[ 1], Input.texCoord); break;
+		case  2: texColor *= texture(uTextures[ 2], Input.texCoord); break;
+		case  3: texColor *= texture(uTextures[ 3], Input.texCoord); break;
+		case  4: texColor *= texture(uTextures[ 4], Input.texCoord); break;
+		case  5: texColor *= texture(uTextures[ 5], Input.texCoord); break;
+		case  6: texColor *= texture(uTextures[ 6], Input.texCoord); break;
+		case  7: texColor *= texture(uTextures[ 7], Input.texCoord); break;
+#if TEXTURE_SLOTS > 8
+		case  8: texColor *= texture(uTextures[ 8], Input.texCoord); break;
+		case  9: texColor *= texture(uTextures[ 9], Input.texCoord); break;
+		case 10: texColor *= texture(uTextures[10], Input.texCoord); break;
+		case 11: texColor *= texture(uTextures[11], Input.texCoord); break;
+		case 12: texColor *= texture(uTextures[12], Input.texCoord); break;
+		case 13: texColor *= texture(uTextures[13], Input.texCoord); break;
+		case 14: texColor *= texture(uTextures[14], Input.texCoord); break;
+		case 15: texColor *= texture(uTextures[15], Input.texCoord); break;
+		case 16: texColor *= texture(uTextures[16], Input.texCoord); break;
+		case 17: texColor *= texture(uTextures[17], Input.texCoord); break;
+		case 18: texColor *= texture(uTextures[18], Input.texCoord); break;
+		case 19: texColor *= texture(uTextures[19], Input.texCoord); break;
+		case 20: texColor *= texture(uTextures[20], Input.texCoord); break;
+		case 21: texColor *= texture(uTextures[21], Input.texCoord); break;
+		case 22: texColor *= texture(uTextures[22], Input.texCoord); break;
+		case 23: texColor *= texture(uTextures[23], Input.texCoord); break;
+		case 24: texColor *= texture(uTextures[24], Input.texCoord); break;
+		case 25: texColor *= texture(uTextures[25], Input.texCoord); break;
+		case 26: texColor *= texture(uTextures[26], Input.texCoord); break;
+		case 27: texColor *= texture(uTextures[27], Input.texCoord); break;
+		case 28: texColor *= texture(uTextures[28], Input.texCoord); break;
+		case 29: texColor *= texture(uTextures[29], Input.texCoord); break;
+		case 30: texColor *= texture(uTextures[30], Input.texCoord); break;
+		case 31: texColor *= texture(uTextures[31], Input.texCoord); break;
+#endif
+	}
+#endif
+	color = texColor;
+	color2 = vEntityID;
+}
\ No newline at end of file
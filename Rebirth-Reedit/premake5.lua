@@ -23,6 +23,7 @@ project "Rebirth-Reedit"
 		"%{IncludeDir.spdlog}",
 		"%{IncludeDir.glm}",
 		"%{IncludeDir.entt}",
+		"%{IncludeDir.stb_image}",
 	}
 
 	links
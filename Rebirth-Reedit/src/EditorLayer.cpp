@@ -55,7 +55,7 @@ namespace rebirth
 			if (std::filesystem::exists(scenePath))
 			{
 				SceneSerializer serializer(mActiveScene);
-				serializer.DeserializeFromYaml(scenePath);
+				serializer.Deserialize(scenePath);
 				mEditorScene = mActiveScene;
 				mEditorScenePath = scenePath;
 			}
@@ -157,7 +157,7 @@ namespace rebirth
 		{
 			Entity cam = mActiveScene->GetPrimaryCameraEntity();
 			if (!cam) return;
-			Renderer2D::BeginScene(cam.GetComponent<CameraComponent>().camera, cam.GetComponent<TransformComponent>().GetTransform());
+			Renderer2D::BeginScene(cam.GetComponent<CameraComponent>().camera, cam.GetComponent<WorldTransformComponent>().transform);
 		}
 		else
 		{
@@ -200,12 +200,9 @@ namespace rebirth
 
 		if (Entity selected = mSceneHierarchyPanel.GetSelectedEntity())
 		{
-			const auto& tc = selected.GetComponent<TransformComponent>();
-			glm::vec3 trans = tc.translation + glm::vec3(0, 0, 0.002f);
-			glm::vec3 scale = tc.scale;
-			glm::mat4 transform = glm::translate(glm::mat4(1.0f), trans) *
-				glm::rotate(glm::mat4(1.0f), tc.rotation.z, { 0, 0, 1 }) *
-				glm::scale(glm::mat4(1.0f), scale);
+			// The scene has already rendered this frame, so the cached matrix is current
+			const auto& world = selected.GetComponent<WorldTransformComponent>();
+			glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(0, 0, 0.002f)) * world.transform;
 			Renderer2D::DrawRect(transform, Colors::YELLOW);
 		}
 
@@ -332,8 +329,26 @@ namespace rebirth
 		ImGui::Text("Render Batch Stats:");
 		ImGui::Text("Draw Calls: %d", stats.drawCalls);
 		ImGui::Text("Quads: %d", stats.quads);
+		ImGui::Text("Static Quads: %d", stats.staticQuads);
+		ImGui::Text("Circles: %d", stats.circles);
+		ImGui::Text("Lines: %d", stats.lines);
+		ImGui::Text("Submitted: %d", stats.submitted);
+		ImGui::Text("Culled: %d", stats.culled);
 		ImGui::Text("Vertex Count: %d", stats.GetVertCount());
 		ImGui::Text("Index Count: %d", stats.GetIndicesCount());
+		ImGui::Text("Atlas Pages: %d", stats.atlasPages);
+		ImGui::Text("Atlas Occupancy: %.1f%%", stats.atlasOccupancy * 100.0f);
+		ImGui::Text("Streaming Textures: %d", TextureStreamer::GetPendingCount());
+
+		const auto& cacheStats = TextureCache::GetStats();
+		ImGui::Text("Cached Textures: %d", cacheStats.textures);
+		ImGui::Text("Texture Memory: %.1f / %.1f MB", cacheStats.residentBytes / (1024.0f * 1024.0f), TextureCache::GetBudget() / (1024.0f * 1024.0f));
+		ImGui::Text("Texture Cache Hit Rate: %.1f%% (%llu hits, %llu misses)", cacheStats.GetHitRate() * 100.0f, cacheStats.hits, cacheStats.misses);
+		ImGui::Text("Texture Evictions: %llu", cacheStats.evictions);
+
+		bool sorting = Renderer2D::IsSortingEnabled();
+		if (UI::Checkbox("Sort Draws", &sorting))
+			Renderer2D::SetSorting(sorting);
 
 		for (int i = 0; i < 6; i++)
 		{
@@ -475,7 +490,7 @@ namespace rebirth
 
 		Ref<Scene> newScene = createRef<Scene>();
 		SceneSerializer serializer(newScene);
-		if (serializer.DeserializeFromYaml(path.string()))
+		if (serializer.Deserialize(path.string()))
 		{
 			mEditorScene = newScene;
 			mEditorScene->OnViewportResize((uint32)mViewportSize.x, (uint32)mViewportSize.y);
@@ -616,8 +631,10 @@ namespace rebirth
 			const glm::mat4& camProj = mEditorCamera.GetProjection();
 			glm::mat4 camView = mEditorCamera.GetViewMatrix();
 
+			// The gizmo works in world space, edits are brought back under the parent before decomposing
 			auto& tc = selectedEntity.GetComponent<TransformComponent>();
-			glm::mat4 transform = tc.GetTransform();
+			glm::mat4 transform = selectedEntity.GetComponent<WorldTransformComponent>().transform;
+			Entity parent = mActiveScene->GetParent(selectedEntity);
 
 			bool snap = Input::IsKeyPressed(KeyCode::LEFT_CONTROL);
 			float snapValue = mGizmoType == ImGuizmo::OPERATION::ROTATE ? 45.0f : mGizmoType == ImGuizmo::OPERATION::SCALE ? 0.25f : 0.5f; // 45 for rotation, 0.25 for scale, 0.5 for translation
@@ -629,12 +646,16 @@ namespace rebirth
 
 			if (ImGuizmo::IsUsing())
 			{
+				if (parent)
+					transform = glm::inverse(parent.GetComponent<WorldTransformComponent>().transform) * transform;
+
 				glm::vec3 translation, rotation, scale;
 				Math::Decompose(transform, translation, rotation, scale);
 				glm::vec3 deltaRot = rotation - tc.rotation;
 				tc.translation = translation;
 				tc.rotation += deltaRot;
 				tc.scale = scale;
+				selectedEntity.Patch<TransformComponent>();
 			}
 
 		}
@@ -37,21 +37,42 @@ namespace rebirth
 	{
 		mDirectoryIcon = Texture2D::Create("assets/icons/directory.png");
 		mFileIcon = Texture2D::Create("assets/icons/file.png");
+		Refresh();
+	}
+
+	void ContentBrowserPanel::SetDirectory(const std::filesystem::path& dir)
+	{
+		mCurrentDir = dir;
+		mThumbnails.CancelPending();
+		Refresh();
+	}
+
+	void ContentBrowserPanel::Refresh()
+	{
+		RB_PROFILE_FUNC();
+		mEntries.clear();
+		for (auto& dirEntry : std::filesystem::directory_iterator(mCurrentDir))
+			mEntries.push_back(dirEntry);
 	}
 
 	void ContentBrowserPanel::OnImguiRender()
 	{
 		RB_PROFILE_FUNC();
+		mThumbnails.Update();
 		ImGui::Begin("Content Browser");
 
 		if (mCurrentDir != gAssetsPath)
 		{
 			if (ImGui::Button("<-"))
 			{
-				mCurrentDir = mCurrentDir.parent_path();
+				SetDirectory(mCurrentDir.parent_path());
 			}
+			ImGui::SameLine();
 		}
 
+		if (ImGui::Button("Refresh"))
+			Refresh();
+
 		static float padding = 16.0f;
 		static float thumbnailSize = 128.0f;
 		float cellSize = thumbnailSize + padding;
@@ -63,8 +84,8 @@ namespace rebirth
 
 		ImGui::Columns(colCount, 0, false);
 
-		//#TODO Should store these entries in a list on panel load and have a refresh button for performance sake
-		for (auto& dirEntry : std::filesystem::directory_iterator(mCurrentDir))
+		std::filesystem::path nextDir;
+		for (auto& dirEntry : mEntries)
 		{
 			const auto& path = dirEntry.path();
 			//auto relPath = std::filesystem::relative(path, gAssetsPath);
@@ -72,10 +93,11 @@ namespace rebirth
 
 			ImGui::PushID(filenameStr.c_str());
 			Ref<Texture2D> icon = dirEntry.is_directory() ? mDirectoryIcon : mFileIcon;
-			if (path.parent_path().string().find("textures") != std::string::npos)
+			// Thumbnails are only asked for once their cell scrolls into view
+			if (!dirEntry.is_directory() && ThumbnailCache::IsImage(path) && ImGui::IsRectVisible({ thumbnailSize, thumbnailSize }))
 			{
-				icon = Texture2D::Create(path.string());
-			//RB_CORE_TRACE(path.extension());
+				if (Ref<Texture2D> thumbnail = mThumbnails.Get(path, (uint32)thumbnailSize))
+					icon = thumbnail;
 			}
 
 			ImGui::PushStyleColor(ImGuiCol_Border, ImVec4(0, 0, 0, 0));
@@ -102,7 +124,7 @@ namespace rebirth
 			if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
 			{
 				if (dirEntry.is_directory())
-					mCurrentDir /= path.filename();
+					nextDir = mCurrentDir / path.filename();
 			}
 			ImGui::TextWrapped(filenameStr.c_str());
 			ImGui::NextColumn();
@@ -110,6 +132,11 @@ namespace rebirth
 		}
 
 		ImGui::Columns(1);
+
+		// Changing directory rebuilds mEntries, so it waits until the loop is done with them
+		if (!nextDir.empty())
+			SetDirectory(nextDir);
+
 		ImGui::SliderFloat("Thumbnail Size", &thumbnailSize, 16, 512);
 		ImGui::SliderFloat("Padding", &padding, 0, 32);
 
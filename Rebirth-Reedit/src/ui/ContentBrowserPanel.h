@@ -23,6 +23,7 @@
 #pragma once
 
 #include "rebirth/renderer/Texture.h"
+#include "ThumbnailCache.h"
 
 namespace rebirth
 {
@@ -34,7 +35,13 @@ namespace rebirth
 		void OnImguiRender();
 
 	private:
+		void SetDirectory(const std::filesystem::path& dir);
+		void Refresh();
+
 		std::filesystem::path mCurrentDir;
+		// Listing of mCurrentDir, only read again when the directory changes or on refresh
+		std::vector<std::filesystem::directory_entry> mEntries;
+		ThumbnailCache mThumbnails;
 
 		Ref<Texture2D> mDirectoryIcon;
 		Ref<Texture2D> mFileIcon;
@@ -48,11 +48,45 @@ namespace rebirth
 
 		if (mContext)
 		{
-			mContext->mRegistry.each([&](auto entity)
-				{
-					Entity e{ entity, mContext.get() };
-					DrawEntityNode(e);
-				});
+			// Stored depth first, so children are the entries right after their parent. Tree nodes are
+			// popped as the walk climbs back up, and entries deeper than the open nodes are collapsed
+			mContext->SortHierarchy();
+			auto view = mContext->mRegistry.view<RelationshipComponent>();
+			uint32 openDepth = 0;
+			for (auto it = view.begin(); it != view.end(); ++it)
+			{
+				const auto& relationship = view.get<RelationshipComponent>(*it);
+				if (relationship.depth > openDepth)
+					continue;
+
+				for (; openDepth > relationship.depth; openDepth--)
+					ImGui::TreePop();
+
+				auto next = std::next(it);
+				bool hasChildren = next != view.end() && view.get<RelationshipComponent>(*next).depth > relationship.depth;
+				if (DrawEntityNode({ *it, mContext.get() }, hasChildren))
+					openDepth++;
+			}
+
+			for (; openDepth > 0; openDepth--)
+				ImGui::TreePop();
+
+			// Changing the hierarchy while walking it would reorder the storage under the loop
+			if (mPendingDelete)
+			{
+				mContext->DestroyEntity(mPendingDelete);
+
+				// Also catches a selected child that went with it
+				if (!mSelectionContext)
+					mSelectionContext = {};
+			}
+
+			if (mPendingChild)
+				mContext->SetParent(mPendingChild, mPendingParent);
+
+			mPendingDelete = {};
+			mPendingChild = {};
+			mPendingParent = {};
 
 
 			if (ImGui::IsWindowHovered() && ImGui::IsMouseDown(0))
@@ -137,43 +171,53 @@ namespace rebirth
 		}
 	}
 
-	void SceneHierarchyPanel::DrawEntityNode(Entity entity)
+	bool SceneHierarchyPanel::DrawEntityNode(Entity entity, bool hasChildren)
 	{
 		auto& tag = entity.GetComponent<TagComponent>().tag;
 
 		ImGuiTreeNodeFlags flags = ((mSelectionContext == entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow
-			| ImGuiTreeNodeFlags_SpanAvailWidth;
+			| ImGuiTreeNodeFlags_SpanAvailWidth | (hasChildren ? 0 : ImGuiTreeNodeFlags_Leaf);
 		bool expanded = ImGui::TreeNodeEx((void*)(uint64)(uint32)entity, flags, tag.c_str());
 		if (ImGui::IsItemClicked())
 		{
 			mSelectionContext = entity;
 		}
 
-		bool deleteEntity = false;
-		// Context menu on entity
-		if (ImGui::BeginPopupContextItem())
+		// Dropping one entity on another makes it a child
+		if (ImGui::BeginDragDropSource())
 		{
-			if (ImGui::MenuItem("Delete Entity"))
-				deleteEntity = true;
-
-			ImGui::EndPopup();
+			uint32 id = (uint32)entity;
+			ImGui::SetDragDropPayload("SCENE_HIERARCHY_ENTITY", &id, sizeof(uint32));
+			ImGui::Text("%s", tag.c_str());
+			ImGui::EndDragDropSource();
 		}
 
-		if (expanded)
+		if (ImGui::BeginDragDropTarget())
 		{
-			ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
-			bool expanded = ImGui::TreeNodeEx((void*)(3456), flags, tag.c_str());
-			if (expanded) ImGui::TreePop();
-			ImGui::TreePop();
+			if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("SCENE_HIERARCHY_ENTITY"))
+			{
+				mPendingChild = { (entt::entity)*(const uint32*)payload->Data, mContext.get() };
+				mPendingParent = entity;
+			}
+			ImGui::EndDragDropTarget();
 		}
 
-		if (deleteEntity)
+		// Context menu on entity
+		if (ImGui::BeginPopupContextItem())
 		{
-			mContext->DestroyEntity(entity);
-			if (mSelectionContext == entity)
-				mSelectionContext = {};
+			if (ImGui::MenuItem("Delete Entity"))
+				mPendingDelete = entity;
+
+			if (entity.GetComponent<RelationshipComponent>().parent != 0 && ImGui::MenuItem("Unparent"))
+			{
+				mPendingChild = entity;
+				mPendingParent = {};
+			}
+
+			ImGui::EndPopup();
 		}
 
+		return expanded;
 	}
 
 
@@ -238,13 +282,19 @@ namespace rebirth
 		ImGui::PopItemWidth();
 
 
-		DrawComponent<TransformComponent>("Transform", entity, [](auto& trans)
+		DrawComponent<TransformComponent>("Transform", entity, [entity](auto& trans) mutable
 			{
+				const TransformComponent previous = trans;
 				UI::DrawFloat3Control("Translation", trans.translation);
-				glm::vec3 rot = glm::degrees(trans.rotation);
+				const glm::vec3 previousRot = glm::degrees(trans.rotation);
+				glm::vec3 rot = previousRot;
 				UI::DrawFloat3Control("Rotation", rot);
-				trans.rotation = glm::radians(rot);
+				if (rot != previousRot)
+					trans.rotation = glm::radians(rot);
 				UI::DrawFloat3Control("Scale", trans.scale, 1.0f);
+
+				if (trans.translation != previous.translation || trans.rotation != previous.rotation || trans.scale != previous.scale)
+					entity.Patch<TransformComponent>();
 			});
 
 
@@ -309,10 +359,12 @@ namespace rebirth
 				}
 			});
 
-		DrawComponent<SpriteComponent>("Sprite", entity, [](auto& component)
+		DrawComponent<SpriteComponent>("Sprite", entity, [entity](auto& component) mutable
 			{
+				bool changed = false;
+
 				// Tint Color
-				UI::ColorEdit("Color", component.color);
+				changed |= UI::ColorEdit("Color", component.color);
 
 				// Texture
 				// #TODO Maybe make the texture be displayed, and that is what the user drags to?
@@ -326,7 +378,11 @@ namespace rebirth
 						std::filesystem::path texturePath = gAssetsPath / path;
 						Ref<Texture2D> texture = Texture2D::Create(texturePath.string());
 						if (texture->IsLoaded())
+						{
 							component.texture = texture;
+							component.subTexture = Renderer2D::GetTextureAtlas().Pack(texture);
+							changed = true;
+						}
 						else
 							RB_CLIENT_WARN("Unable to load texture {}", texturePath.filename().string());
 					}
@@ -335,7 +391,15 @@ namespace rebirth
 				ImGui::TextUnformatted(tex->GetPath().c_str());
 
 				// Tiling Factor
-				UI::DrawFloatControl("Tiling Factor", &component.tilingFactor, 0.01f, 0.0f, 100.0f);
+				changed |= UI::DrawFloatControl("Tiling Factor", &component.tilingFactor, 0.01f, 0.0f, 100.0f);
+
+				changed |= UI::DrawIntControl("Layer", &component.layer, 0.1f, SortKey::MIN_LAYER, SortKey::MAX_LAYER);
+
+				// Static sprites are baked once and only rebuilt when they change
+				changed |= UI::Checkbox("Static", &component.isStatic);
+
+				if (changed)
+					entity.Patch<SpriteComponent>();
 			});
 
 		DrawComponent<CircleComponent>("Circle", entity, [](auto& component)
@@ -343,6 +407,7 @@ namespace rebirth
 				UI::ColorEdit("Color", component.color);
 				UI::DrawFloatControl("Thickness", &component.thickness, 0.025f, 0.0f, 1.0f);
 				UI::DrawFloatControl("Fade", &component.fade, 0.00025f, 0.0f, 3.0f);
+				UI::DrawIntControl("Layer", &component.layer, 0.1f, SortKey::MIN_LAYER, SortKey::MAX_LAYER);
 			});
 
 
@@ -41,10 +41,16 @@ namespace rebirth
 
 	private:
 
-		void DrawEntityNode(Entity entity);
+		// Returns whether the node is open, the caller pops it once its children are drawn
+		bool DrawEntityNode(Entity entity, bool hasChildren);
 		void DrawComponents(Entity entity);
 
 		Ref<Scene> mContext;
 		Entity mSelectionContext;
+
+		// Applied once the hierarchy has been drawn
+		Entity mPendingDelete;
+		Entity mPendingChild;
+		Entity mPendingParent;
 	};
 }
@@ -0,0 +1,283 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: ThumbnailCache.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "ThumbnailCache.h"
+
+#include <stb_image.h>
+
+#include <fstream>
+
+namespace rebirth
+{
+	static constexpr uint32 sThumbnailMagic = 0x48544252; // "RBTH"
+	// Bump whenever the way thumbnails are made or written changes
+	static constexpr uint32 sThumbnailVersion = 2;
+
+	// Thumbnails uploaded per frame, each one waits on the render thread to create its texture
+	static constexpr uint32 sUploadsPerFrame = 4;
+
+	struct ThumbnailHeader
+	{
+		uint32 magic;
+		uint32 version;
+		int64 modified;
+		uint32 width;
+		uint32 height;
+		uint32 sourceLength; // followed by the path and size the thumbnail was made for, then the pixels
+	};
+
+	// Leaves the stream at the pixels when the cached thumbnail is usable
+	static bool ReadHeader(std::ifstream& in, const std::string& source, const int64 modified, ThumbnailHeader& outHeader)
+	{
+		if (!in.read((char*)&outHeader, sizeof(outHeader)) || outHeader.magic != sThumbnailMagic || outHeader.version != sThumbnailVersion)
+			return false;
+
+		if (outHeader.modified != modified || !outHeader.width || !outHeader.height ||
+			outHeader.width > ThumbnailCache::MAX_SIZE || outHeader.height > ThumbnailCache::MAX_SIZE)
+			return false;
+
+		if (outHeader.sourceLength != source.size())
+			return false;
+
+		std::string cachedSource(source.size(), '\0');
+		return in.read(cachedSource.data(), cachedSource.size()) && cachedSource == source;
+	}
+
+	static const char* GetCacheDirectory()
+	{
+		return "assets/cache/thumbnails";
+	}
+
+	static uint32 GetBucket(uint32 size)
+	{
+		uint32 bucket = ThumbnailCache::MIN_SIZE;
+		while (bucket < size && bucket < ThumbnailCache::MAX_SIZE)
+			bucket <<= 1;
+		return bucket;
+	}
+
+	// Box filter, each thumbnail pixel averages the source pixels it covers
+	static void Downsample(const byte* src, uint32 srcWidth, uint32 srcHeight, byte* dst, uint32 dstWidth, uint32 dstHeight)
+	{
+		for (uint32 y = 0; y < dstHeight; y++)
+		{
+			uint32 y0 = (uint32)((uint64)y * srcHeight / dstHeight);
+			uint32 y1 = std::max(y0 + 1, (uint32)((uint64)(y + 1) * srcHeight / dstHeight));
+			for (uint32 x = 0; x < dstWidth; x++)
+			{
+				uint32 x0 = (uint32)((uint64)x * srcWidth / dstWidth);
+				uint32 x1 = std::max(x0 + 1, (uint32)((uint64)(x + 1) * srcWidth / dstWidth));
+
+				uint32 sum[4] = {};
+				for (uint32 sy = y0; sy < y1; sy++)
+				{
+					const byte* row = src + ((size_t)sy * srcWidth + x0) * 4;
+					for (uint32 sx = x0; sx < x1; sx++, row += 4)
+					{
+						sum[0] += row[0];
+						sum[1] += row[1];
+						sum[2] += row[2];
+						sum[3] += row[3];
+					}
+				}
+
+				uint32 count = (y1 - y0) * (x1 - x0);
+				byte* out = dst + ((size_t)y * dstWidth + x) * 4;
+				for (int c = 0; c < 4; c++)
+					out[c] = (byte)(sum[c] / count);
+			}
+		}
+	}
+
+	ThumbnailCache::ThumbnailCache(const uint32 maxResident) :
+		mMaxResident(maxResident)
+	{
+		std::error_code error;
+		std::filesystem::create_directories(GetCacheDirectory(), error);
+	}
+
+	ThumbnailCache::~ThumbnailCache()
+	{
+		// Jobs that haven't started skip their work, the ones that have still hold this
+		mRunning = false;
+		JobSystem::Wait(mJobs);
+	}
+
+	bool ThumbnailCache::IsImage(const std::filesystem::path& path)
+	{
+		std::string extension = path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower(c); });
+		return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+	}
+
+	Ref<Texture2D> ThumbnailCache::Get(const std::filesystem::path& path, const uint32 size)
+	{
+		const uint32 bucket = GetBucket(size);
+		std::string key = fmt::format("{}|{}", path.generic_string(), bucket);
+
+		auto it = mEntries.find(key);
+		if (it != mEntries.end())
+		{
+			it->second.lastUsed = mFrame;
+			return it->second.texture;
+		}
+
+		mEntries[key].lastUsed = mFrame;
+		JobSystem::ExecuteBackground("ThumbnailCache::Make", [this, request = Request{ std::move(key), path, bucket }, generation = mGeneration.load()]()
+			{
+				Make(request, generation);
+			}, &mJobs);
+		return nullptr;
+	}
+
+	void ThumbnailCache::Update()
+	{
+		RB_PROFILE_FUNC();
+		mFrame++;
+
+		uint32 uploaded = 0;
+		while (uploaded < sUploadsPerFrame)
+		{
+			Result result;
+			{
+				std::lock_guard lock(mMutex);
+				if (mResults.empty())
+					break;
+
+				result = std::move(mResults.front());
+				mResults.pop_front();
+			}
+
+			// Cancelled while it was being made
+			auto it = mEntries.find(result.key);
+			if (it == mEntries.end())
+				continue;
+
+			if (result.pixels.empty())
+			{
+				it->second.failed = true;
+				continue;
+			}
+
+			it->second.texture = Texture2D::Create(result.width, result.height);
+			it->second.texture->SetData(result.pixels.data(), (uint32)result.pixels.size());
+			uploaded++;
+		}
+
+		if (mEntries.size() <= mMaxResident)
+			return;
+
+		// Only thumbnails that are done can go, the rest still have a request or result in flight
+		std::vector<std::pair<uint64, const std::string*>> done;
+		for (const auto& [key, entry] : mEntries)
+		{
+			if (entry.texture || entry.failed)
+				done.emplace_back(entry.lastUsed, &key);
+		}
+
+		std::sort(done.begin(), done.end());
+		size_t excess = std::min(mEntries.size() - mMaxResident, done.size());
+		for (size_t i = 0; i < excess; i++)
+			mEntries.erase(*done[i].second);
+	}
+
+	void ThumbnailCache::CancelPending()
+	{
+		mGeneration++;
+
+		for (auto it = mEntries.begin(); it != mEntries.end();)
+		{
+			if (!it->second.texture && !it->second.failed)
+				it = mEntries.erase(it);
+			else
+				++it;
+		}
+	}
+
+	void ThumbnailCache::Make(const Request& request, const uint32 generation)
+	{
+		if (!mRunning || generation != mGeneration)
+			return;
+
+		stbi_set_flip_vertically_on_load_thread(1);
+
+		Result result;
+		result.key = request.key;
+		if (!Generate(request, result))
+			RB_CORE_WARN("Failed to make a thumbnail for {}", request.path.string());
+
+		std::lock_guard lock(mMutex);
+		mResults.push_back(std::move(result));
+	}
+
+	bool ThumbnailCache::Generate(const Request& request, Result& outResult)
+	{
+		RB_PROFILE_FUNC();
+
+		std::error_code error;
+		auto modifiedTime = std::filesystem::last_write_time(request.path, error);
+		if (error)
+			return false;
+
+		const int64 modified = (int64)modifiedTime.time_since_epoch().count();
+		const std::string source = fmt::format("{}|{}", request.path.generic_string(), request.size);
+		const std::filesystem::path cachePath = std::filesystem::path(GetCacheDirectory()) / fmt::format("{:016x}.thumb", (uint64)std::hash<std::string>()(source));
+
+		// A thumbnail written for an older version of the image, or for another image whose name hashes
+		// to the same file, is simply overwritten below
+		ThumbnailHeader header = {};
+		std::ifstream in(cachePath, std::ios::binary);
+		if (ReadHeader(in, source, modified, header))
+		{
+			outResult.pixels.resize((size_t)header.width * header.height * 4);
+			if (in.read((char*)outResult.pixels.data(), outResult.pixels.size()))
+			{
+				outResult.width = header.width;
+				outResult.height = header.height;
+				return true;
+			}
+			outResult.pixels.clear();
+		}
+		in.close();
+
+		int width, height, channels;
+		byte* pixels = stbi_load(request.path.string().c_str(), &width, &height, &channels, 4);
+		if (!pixels)
+			return false;
+
+		// Keeps the aspect ratio, never upscales
+		float scale = std::min(1.0f, (float)request.size / (float)std::max(width, height));
+		outResult.width = std::max(1u, (uint32)(width * scale));
+		outResult.height = std::max(1u, (uint32)(height * scale));
+		outResult.pixels.resize((size_t)outResult.width * outResult.height * 4);
+		Downsample(pixels, (uint32)width, (uint32)height, outResult.pixels.data(), outResult.width, outResult.height);
+		stbi_image_free(pixels);
+
+		header = { sThumbnailMagic, sThumbnailVersion, modified, outResult.width, outResult.height, (uint32)source.size() };
+		std::ofstream out(cachePath, std::ios::binary);
+		out.write((const char*)&header, sizeof(header));
+		out.write(source.data(), source.size());
+		out.write((const char*)outResult.pixels.data(), outResult.pixels.size());
+		return true;
+	}
+}
@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: ThumbnailCache.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "rebirth/renderer/Texture.h"
+#include "rebirth/core/JobSystem.h"
+
+#include <mutex>
+#include <deque>
+
+namespace rebirth
+{
+	// Downsampled previews of the images shown in the content browser. Thumbnails are made as background
+	// jobs and written to assets/cache/thumbnails keyed by the image's path and modification time,
+	// so an image is only decoded at full size once until it changes
+	class ThumbnailCache
+	{
+	public:
+		// Thumbnails are made at the power of two at or above the requested size within these
+		static constexpr uint32 MIN_SIZE = 64;
+		static constexpr uint32 MAX_SIZE = 512;
+
+		ThumbnailCache(uint32 maxResident = 512);
+		~ThumbnailCache();
+
+		ThumbnailCache(const ThumbnailCache&) = delete;
+		ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+		static bool IsImage(const std::filesystem::path& path);
+
+		// nullptr until the thumbnail is ready. Only call it for cells that are visible, each call queues the work
+		Ref<Texture2D> Get(const std::filesystem::path& path, uint32 size);
+
+		// Uploads a few finished thumbnails and evicts the least recently used past the resident limit, once a frame
+		void Update();
+
+		// Drops the thumbnails not made yet, e.g. after leaving a folder
+		void CancelPending();
+
+	private:
+		struct Request
+		{
+			std::string key;
+			std::filesystem::path path;
+			uint32 size;
+		};
+
+		struct Result
+		{
+			std::string key;
+			uint32 width = 0;
+			uint32 height = 0;
+			std::vector<byte> pixels;
+		};
+
+		struct Entry
+		{
+			Ref<Texture2D> texture;
+			uint64 lastUsed = 0;
+			bool failed = false;
+		};
+
+		void Make(const Request& request, uint32 generation);
+		static bool Generate(const Request& request, Result& outResult);
+
+		JobCounter mJobs;
+		std::mutex mMutex;
+		std::deque<Result> mResults;
+		std::atomic<bool> mRunning = true;
+		// Bumped by CancelPending, jobs queued before it skip their work
+		std::atomic<uint32> mGeneration = 0;
+
+		// Main thread only, an entry without a texture is still being made
+		std::unordered_map<std::string, Entry> mEntries;
+		uint32 mMaxResident;
+		uint64 mFrame = 0;
+	};
+}
@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: ShaderCook.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+#include <Rebirth.h>
+#include <platform/opengl/OpenGLShaderPack.h>
+
+#include <filesystem>
+
+// Cooks shaders into the pack OpenGLShader loads at startup. Run it from the project directory:
+//   Rebirth-ShaderCook [-o <pack>] <shader directory>...
+// The pack goes to assets/shaders.rbpack unless -o says otherwise. Every .glsl file is cooked as is
+// and once more per "#variant NAME=VALUE,..." line above its first #type, a .vert with a .frag of
+// the same name is cooked as one shader. Compiled stages go through the shader cache like at runtime
+
+using rebirth::OpenGLShaderPack;
+
+static void PrintUsage()
+{
+	RB_CLIENT_INFO("Usage: Rebirth-ShaderCook [-o <pack>] <shader directory>...");
+}
+
+int main(int argc, char** argv)
+{
+	rebirth::Log::Init();
+
+	std::string output = OpenGLShaderPack::DEFAULT_PATH;
+	std::vector<std::string> directories;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if ((arg == "-o" || arg == "--output") && i + 1 < argc)
+			output = argv[++i];
+		else if (arg == "-h" || arg == "--help")
+		{
+			PrintUsage();
+			return 0;
+		}
+		else
+			directories.push_back(arg);
+	}
+
+	if (directories.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<std::string> files;
+	for (const auto& directory : directories)
+	{
+		if (!std::filesystem::is_directory(directory))
+		{
+			RB_CLIENT_ERROR("{} is not a directory", directory);
+			return 1;
+		}
+
+		for (const auto& entry : std::filesystem::directory_iterator(directory))
+		{
+			if (entry.is_regular_file())
+				files.push_back(entry.path().string());
+		}
+	}
+
+	if (!OpenGLShaderPack::Cook(files, output))
+		return 1;
+
+	RB_CLIENT_INFO("Wrote {} ({} bytes)", output, std::filesystem::file_size(output));
+	return 0;
+}
@@ -0,0 +1,130 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureCook.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include <Rebirth.h>
+#include <rebirth/renderer/CookedTexture.h>
+
+#include <filesystem>
+
+// Cooks textures into the .rbtex files Texture2D::Create loads in place of their source. Run it from the project directory:
+//   Rebirth-TextureCook [-f] [--uncompressed] <texture directory>...
+// Every image under the directories is cooked to <image>.rbtex next to it, with its full mip chain and
+// compressed to BC1, or BC3 if it has any transparency. Images whose .rbtex is newer are skipped unless -f is given
+
+using rebirth::CookedTexture;
+using rebirth::JobSystem;
+
+static bool IsImage(const std::filesystem::path& path)
+{
+	std::string extension = path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower(c); });
+	return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+}
+
+static void PrintUsage()
+{
+	RB_CLIENT_INFO("Usage: Rebirth-TextureCook [-f] [--uncompressed] <texture directory>...");
+}
+
+int main(int argc, char** argv)
+{
+	rebirth::Log::Init();
+
+	bool force = false;
+	bool compress = true;
+	std::vector<std::string> directories;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-f" || arg == "--force")
+			force = true;
+		else if (arg == "--uncompressed")
+			compress = false;
+		else if (arg == "-h" || arg == "--help")
+		{
+			PrintUsage();
+			return 0;
+		}
+		else
+			directories.push_back(arg);
+	}
+
+	if (directories.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<std::string> files;
+	for (const auto& directory : directories)
+	{
+		if (!std::filesystem::is_directory(directory))
+		{
+			RB_CLIENT_ERROR("{} is not a directory", directory);
+			return 1;
+		}
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+		{
+			if (!entry.is_regular_file() || !IsImage(entry.path()))
+				continue;
+
+			std::string path = entry.path().generic_string();
+			if (!force && !CookedTexture::FindCooked(path).empty())
+				continue;
+
+			files.push_back(path);
+		}
+	}
+	std::sort(files.begin(), files.end());
+
+	// One texture per job, they take too long for batching to matter
+	std::vector<uint8_t> cooked(files.size());
+	JobSystem::Init();
+	JobSystem::ParallelFor("TextureCook", (uint32_t)files.size(), 1, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				cooked[i] = CookedTexture::Cook(files[i], CookedTexture::GetCookedPath(files[i]), compress);
+		});
+	JobSystem::Shutdown();
+
+	bool failed = false;
+	uint64_t sourceBytes = 0;
+	uint64_t cookedBytes = 0;
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		if (!cooked[i])
+		{
+			RB_CLIENT_ERROR("Failed to cook {}", files[i]);
+			failed = true;
+			continue;
+		}
+
+		std::string cookedPath = CookedTexture::GetCookedPath(files[i]);
+		sourceBytes += std::filesystem::file_size(files[i]);
+		cookedBytes += std::filesystem::file_size(cookedPath);
+		RB_CLIENT_INFO("Cooked {}", cookedPath);
+	}
+
+	RB_CLIENT_INFO("Cooked {} textures, {} bytes of images to {} bytes", files.size(), sourceBytes, cookedBytes);
+	return failed ? 1 : 0;
+}
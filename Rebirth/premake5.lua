@@ -93,14 +93,12 @@ project "Rebirth"
 			"%{Library.SPIRV_Cross_GLSL_Release}"
 		}
 
+	-- Shaders come from the pack cooked by Rebirth-ShaderCook, so the compiler isn't linked
 	filter "configurations:Dist"
-		defines "RB_DIST"
-		runtime "Release"
-		optimize "on"
-
-		links
+		defines
 		{
-			"%{Library.ShaderC_Release}",
-			"%{Library.SPIRV_Cross_Release}",
-			"%{Library.SPIRV_Cross_GLSL_Release}"
-		}
\ No newline at end of file
+			"RB_DIST",
+			"RB_NO_SHADER_COMPILER"
+		}
+		runtime "Release"
+		optimize "on"
\ No newline at end of file
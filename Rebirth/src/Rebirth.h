@@ -29,6 +29,7 @@
 #include "rebirth/core/Timestep.h"
 #include "rebirth/core/OrthoCameraController.h"
 #include "rebirth/core/Assets.h"
+#include "rebirth/core/JobSystem.h"
 
 // Util
 #include "rebirth/util/PlatformUtil.h"
@@ -59,11 +60,14 @@
 #include "rebirth/renderer/RenderCommand.h"
 #include "rebirth/renderer/Shader.h"
 #include "rebirth/renderer/Texture.h"
+#include "rebirth/renderer/TextureStreamer.h"
+#include "rebirth/renderer/TextureCache.h"
 #include "rebirth/renderer/SubTexture.h"
 #include "rebirth/renderer/VertexArray.h"
 #include "rebirth/renderer/OrthoCamera.h"
 #include "rebirth/renderer/Framebuffer.h"
 #include "rebirth/renderer/EditorCamera.h"
+#include "rebirth/renderer/SortKey.h"
 
 
 // Scene
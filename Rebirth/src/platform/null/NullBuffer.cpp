@@ -0,0 +1,109 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullBuffer.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+
+#include "rbpch.h"
+#include "NullBuffer.h"
+
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+
+	/////////////////////////////////////
+	/// Vertex Buffer ///////////////////
+	/////////////////////////////////////
+
+	NullVertexBuffer::NullVertexBuffer(const uint32 size) :
+		mId(NullCommandLog::NextResourceId()), mSize(size)
+	{
+	}
+
+	NullVertexBuffer::NullVertexBuffer(const uint32 size, float* vertices) :
+		mId(NullCommandLog::NextResourceId()), mSize(size)
+	{
+		NullCommandLog::Record(NullCommandType::UPLOAD_VERTEX_BUFFER, mId, size);
+	}
+
+	void NullVertexBuffer::Bind() const
+	{
+		NullCommandLog::Record(NullCommandType::BIND_VERTEX_BUFFER, mId);
+	}
+
+	void NullVertexBuffer::Unbind() const
+	{
+	}
+
+	void NullVertexBuffer::SetData(const void* data, uint32 size)
+	{
+		RB_CORE_ASSERT(size <= mSize, "Vertex buffer upload is larger than the buffer");
+		NullCommandLog::Record(NullCommandType::UPLOAD_VERTEX_BUFFER, mId, size);
+	}
+
+	/////////////////////////////////////
+	/// Streaming Vertex Buffer /////////
+	/////////////////////////////////////
+
+	NullStreamingVertexBuffer::NullStreamingVertexBuffer(const uint32 regionSize, const uint32 regionCount) :
+		mId(NullCommandLog::NextResourceId()), mRegionSize(regionSize), mRegionCount(regionCount),
+		mMemory((size_t)regionSize * regionCount)
+	{
+		RB_CORE_ASSERT(regionCount > 0, "Streaming buffer needs at least one region");
+	}
+
+	void NullStreamingVertexBuffer::Bind() const
+	{
+		NullCommandLog::Record(NullCommandType::BIND_VERTEX_BUFFER, mId);
+	}
+
+	void NullStreamingVertexBuffer::Unbind() const
+	{
+	}
+
+	void NullStreamingVertexBuffer::SetData(const void* data, const uint32 size)
+	{
+		RB_CORE_ASSERT(size <= mRegionSize, "Vertex data is larger than a streaming region");
+		memcpy(GetMappedRegion(), data, size);
+	}
+
+	/////////////////////////////////////
+	/// Index Buffer ////////////////////
+	/////////////////////////////////////
+
+
+	NullIndexBuffer::NullIndexBuffer(const uint32 count, uint32* indices) :
+		mId(NullCommandLog::NextResourceId()), mCount(count)
+	{
+		NullCommandLog::Record(NullCommandType::UPLOAD_INDEX_BUFFER, mId, count * sizeof(uint32));
+	}
+
+	void NullIndexBuffer::Bind() const
+	{
+		NullCommandLog::Record(NullCommandType::BIND_INDEX_BUFFER, mId);
+	}
+
+	void NullIndexBuffer::Unbind() const
+	{
+	}
+
+}
@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullBuffer.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "rebirth/renderer/Buffer.h"
+
+namespace rebirth
+{
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer(uint32 size);
+		NullVertexBuffer(uint32 size, float* vertices);
+		~NullVertexBuffer() override = default;
+		void Bind() const override;
+		void Unbind() const override;
+
+		void SetLayout(const BufferLayout& layout) override
+		{
+			mLayout = layout;
+		}
+
+		const BufferLayout& GetLayout() const override
+		{
+			return mLayout;
+		}
+
+		void SetData(const void* data, uint32 size) override;
+
+		uint32 GetSize() const { return mSize; }
+
+	private:
+		uint32 mId;
+		uint32 mSize;
+		BufferLayout mLayout;
+	};
+
+	// CPU memory stands in for the mapped GPU buffer, nothing is recorded as an upload
+	class NullStreamingVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullStreamingVertexBuffer(uint32 regionSize, uint32 regionCount);
+		~NullStreamingVertexBuffer() override = default;
+		void Bind() const override;
+		void Unbind() const override;
+
+		void SetLayout(const BufferLayout& layout) override
+		{
+			mLayout = layout;
+		}
+
+		const BufferLayout& GetLayout() const override
+		{
+			return mLayout;
+		}
+
+		void SetData(const void* data, uint32 size) override;
+
+		bool IsStreaming() const override { return true; }
+		void* GetMappedRegion() override { return mMemory.data() + (size_t)mRegion * mRegionSize; }
+		uint32 GetRegionOffset() const override { return mRegion * mRegionSize; }
+		void NextRegion() override { mRegion = (mRegion + 1) % mRegionCount; }
+
+	private:
+		uint32 mId;
+		uint32 mRegionSize;
+		uint32 mRegionCount;
+		uint32 mRegion = 0;
+		std::vector<byte> mMemory;
+		BufferLayout mLayout;
+	};
+
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer(uint32 count, uint32* indices);
+		~NullIndexBuffer() override = default;
+		void Bind() const override;
+		void Unbind() const override;
+
+		uint32 GetCount() const override { return mCount; }
+
+	private:
+		uint32 mId;
+		uint32 mCount;
+	};
+}
@@ -0,0 +1,131 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullCommandLog.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+#include "rbpch.h"
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+	std::mutex NullCommandLog::sMutex;
+	std::vector<NullCommand> NullCommandLog::sCommands;
+	NullCommandTotals NullCommandLog::sTotals;
+	std::atomic<bool> NullCommandLog::sRecording = false;
+	std::atomic<uint32> NullCommandLog::sResourceCounter = 0;
+
+	void NullCommandLog::Record(NullCommandType type, uint32 resourceId, uint32 count)
+	{
+		std::lock_guard lock(sMutex);
+		switch (type)
+		{
+			case NullCommandType::DRAW_INDEXED:
+			case NullCommandType::DRAW_INDEXED_INSTANCED:
+				sTotals.drawCalls++;
+				sTotals.indices += count;
+				break;
+			case NullCommandType::DRAW_LINES:
+				sTotals.drawCalls++;
+				sTotals.lineVertices += count;
+				break;
+			case NullCommandType::BIND_VERTEX_ARRAY:
+			case NullCommandType::BIND_VERTEX_BUFFER:
+			case NullCommandType::BIND_INDEX_BUFFER:
+			case NullCommandType::BIND_SHADER:
+			case NullCommandType::BIND_TEXTURE:
+			case NullCommandType::BIND_FRAMEBUFFER:
+				sTotals.binds++;
+				break;
+			case NullCommandType::UPLOAD_VERTEX_BUFFER:
+			case NullCommandType::UPLOAD_INDEX_BUFFER:
+			case NullCommandType::UPLOAD_UNIFORM_BUFFER:
+			case NullCommandType::UPLOAD_TEXTURE:
+				sTotals.uploads++;
+				sTotals.bytesUploaded += count;
+				break;
+			default:
+				break;
+		}
+
+		if (sRecording)
+			sCommands.push_back({ type, resourceId, count });
+	}
+
+	void NullCommandLog::Reset()
+	{
+		std::lock_guard lock(sMutex);
+		sCommands.clear();
+		sTotals = {};
+	}
+
+	std::vector<NullCommand> NullCommandLog::GetCommands()
+	{
+		std::lock_guard lock(sMutex);
+		return sCommands;
+	}
+
+	NullCommandTotals NullCommandLog::GetTotals()
+	{
+		std::lock_guard lock(sMutex);
+		return sTotals;
+	}
+
+	uint32 NullCommandLog::Count(NullCommandType type)
+	{
+		std::lock_guard lock(sMutex);
+		uint32 count = 0;
+		for (const auto& cmd : sCommands)
+		{
+			if (cmd.type == type)
+				count++;
+		}
+		return count;
+	}
+
+	const char* NullCommandLog::TypeToString(NullCommandType type)
+	{
+		switch (type)
+		{
+			case NullCommandType::NONE: return "None";
+			case NullCommandType::CLEAR: return "Clear";
+			case NullCommandType::SET_VIEWPORT: return "SetViewport";
+			case NullCommandType::SET_CLEAR_COLOR: return "SetClearColor";
+			case NullCommandType::SET_LINE_WIDTH: return "SetLineWidth";
+			case NullCommandType::DRAW_INDEXED: return "DrawIndexed";
+			case NullCommandType::DRAW_INDEXED_INSTANCED: return "DrawIndexedInstanced";
+			case NullCommandType::DRAW_LINES: return "DrawLines";
+			case NullCommandType::BIND_VERTEX_ARRAY: return "BindVertexArray";
+			case NullCommandType::BIND_VERTEX_BUFFER: return "BindVertexBuffer";
+			case NullCommandType::BIND_INDEX_BUFFER: return "BindIndexBuffer";
+			case NullCommandType::BIND_SHADER: return "BindShader";
+			case NullCommandType::BIND_TEXTURE: return "BindTexture";
+			case NullCommandType::BIND_FRAMEBUFFER: return "BindFramebuffer";
+			case NullCommandType::UPLOAD_VERTEX_BUFFER: return "UploadVertexBuffer";
+			case NullCommandType::UPLOAD_INDEX_BUFFER: return "UploadIndexBuffer";
+			case NullCommandType::UPLOAD_UNIFORM_BUFFER: return "UploadUniformBuffer";
+			case NullCommandType::UPLOAD_TEXTURE: return "UploadTexture";
+			case NullCommandType::SET_UNIFORM: return "SetUniform";
+		}
+
+		RB_CORE_ASSERT(false, "Unknown null command type");
+		return "Unknown";
+	}
+}
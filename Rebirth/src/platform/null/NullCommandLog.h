@@ -0,0 +1,110 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullCommandLog.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+namespace rebirth
+{
+	enum class NullCommandType
+	{
+		NONE = 0,
+
+		CLEAR,
+		SET_VIEWPORT,
+		SET_CLEAR_COLOR,
+		SET_LINE_WIDTH,
+
+		DRAW_INDEXED,
+		DRAW_INDEXED_INSTANCED, // count is indices per instance * instances
+		DRAW_LINES,
+
+		BIND_VERTEX_ARRAY,
+		BIND_VERTEX_BUFFER,
+		BIND_INDEX_BUFFER,
+		BIND_SHADER,
+		BIND_TEXTURE,
+		BIND_FRAMEBUFFER,
+
+		UPLOAD_VERTEX_BUFFER,
+		UPLOAD_INDEX_BUFFER,
+		UPLOAD_UNIFORM_BUFFER,
+		UPLOAD_TEXTURE,
+
+		SET_UNIFORM
+	};
+
+	// A single recorded command. Meaning of count depends on the type:
+	// index/vertex count for draws, texture slot for texture binds, byte size for uploads
+	struct NullCommand
+	{
+		NullCommandType type = NullCommandType::NONE;
+		uint32 resourceId = 0;
+		uint32 count = 0;
+	};
+
+	// Running totals, kept even when command recording is disabled
+	struct NullCommandTotals
+	{
+		uint32 drawCalls = 0;
+		uint32 indices = 0;
+		uint32 lineVertices = 0;
+		uint32 binds = 0;
+		uint32 uploads = 0;
+		uint64 bytesUploaded = 0;
+	};
+
+	// Inspectable log of everything the null backend was asked to do
+	class NullCommandLog
+	{
+	public:
+		static void Record(NullCommandType type, uint32 resourceId = 0, uint32 count = 0);
+
+		// Clears both the recorded commands and the totals
+		static void Reset();
+
+		// Off by default, then only the totals are updated. Turn it on around the commands to inspect,
+		// the list grows with every command until Reset
+		static void SetRecording(bool enabled) { sRecording = enabled; }
+		static bool IsRecording() { return sRecording; }
+
+		// Copies, batches can be recorded from job workers while these are read
+		static std::vector<NullCommand> GetCommands();
+		static NullCommandTotals GetTotals();
+
+		static uint32 Count(NullCommandType type);
+
+		static uint32 NextResourceId() { return ++sResourceCounter; }
+
+		static const char* TypeToString(NullCommandType type);
+
+	private:
+		// Guards the commands and totals
+		static std::mutex sMutex;
+		static std::vector<NullCommand> sCommands;
+		static NullCommandTotals sTotals;
+		static std::atomic<bool> sRecording;
+		static std::atomic<uint32> sResourceCounter; // shaders can be created on worker threads
+	};
+}
@@ -0,0 +1,86 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullFramebuffer.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+#include "rbpch.h"
+#include "NullFramebuffer.h"
+
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+
+	static constexpr uint32 sMaxFramebufferSize = 8192;
+
+	static bool IsDepthFormat(FramebufferTextureFormat format)
+	{
+		switch (format)
+		{
+			case FramebufferTextureFormat::DEPTH24_STENCIL8: return true;
+		}
+		return false;
+	}
+
+	NullFramebuffer::NullFramebuffer(const FramebufferDesc& spec) :
+		mDesc(spec), mId(NullCommandLog::NextResourceId())
+	{
+		for (auto desc : mDesc.attachements.attachments)
+		{
+			if (!IsDepthFormat(desc.textureFormat))
+				mColorAttachments.push_back(NullCommandLog::NextResourceId());
+		}
+	}
+
+	void NullFramebuffer::Bind()
+	{
+		NullCommandLog::Record(NullCommandType::BIND_FRAMEBUFFER, mId);
+	}
+
+	void NullFramebuffer::Unbind()
+	{
+		NullCommandLog::Record(NullCommandType::BIND_FRAMEBUFFER, 0);
+	}
+
+	void NullFramebuffer::Resize(uint32 width, uint32 height)
+	{
+		if (width == 0 || height == 0 || width > sMaxFramebufferSize || height > sMaxFramebufferSize)
+		{
+			RB_CORE_WARN("Attempted an invalid framebuffer resize to ({}, {})", width, height);
+			return;
+		}
+		mDesc.width = width;
+		mDesc.height = height;
+	}
+
+	int NullFramebuffer::ReadPixel(uint32 attachmentIndex, int x, int y)
+	{
+		RB_CORE_ASSERT(attachmentIndex < mColorAttachments.size());
+		return -1;
+	}
+
+	void NullFramebuffer::ClearAttachment(uint32 attachmentIndex, int value)
+	{
+		RB_CORE_ASSERT(attachmentIndex < mColorAttachments.size());
+		NullCommandLog::Record(NullCommandType::CLEAR, mColorAttachments[attachmentIndex]);
+	}
+
+}
@@ -0,0 +1,81 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullGraphicsAPI.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+
+#include "NullGraphicsAPI.h"
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+
+	void NullGraphicsAPI::Init()
+	{
+		RB_PROFILE_FUNC();
+
+		auto& capabilities = GraphicsAPI::GetCapabilities();
+		capabilities.version = "Null";
+		capabilities.renderer = "Null Recording Renderer";
+		capabilities.vendor = "Rebirth";
+		capabilities.maxSamples = 1;
+		capabilities.maxAniostropy = 1.0f;
+		capabilities.persistentMapping = true;
+		capabilities.textureCompression = true;
+	}
+
+	void NullGraphicsAPI::SetViewport(const uint32 x, const uint32 y, const uint32 width, const uint32 height)
+	{
+		NullCommandLog::Record(NullCommandType::SET_VIEWPORT, 0, width * height);
+	}
+
+	void NullGraphicsAPI::SetClearColor(const glm::vec4& color)
+	{
+		NullCommandLog::Record(NullCommandType::SET_CLEAR_COLOR);
+	}
+
+	void NullGraphicsAPI::Clear()
+	{
+		NullCommandLog::Record(NullCommandType::CLEAR);
+	}
+
+	void NullGraphicsAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 count, uint32 vertexOffset)
+	{
+		uint32 indexCount = count ? count : vertexArray->GetIndexBuffer()->GetCount();
+		NullCommandLog::Record(NullCommandType::DRAW_INDEXED, 0, indexCount);
+	}
+
+	void NullGraphicsAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32 indexCount, uint32 instanceCount, uint32 instanceOffset)
+	{
+		NullCommandLog::Record(NullCommandType::DRAW_INDEXED_INSTANCED, 0, indexCount * instanceCount);
+	}
+
+	void NullGraphicsAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount, uint32 vertexOffset)
+	{
+		NullCommandLog::Record(NullCommandType::DRAW_LINES, 0, vertexCount);
+	}
+
+	void NullGraphicsAPI::SetLineWidth(float width)
+	{
+		NullCommandLog::Record(NullCommandType::SET_LINE_WIDTH);
+	}
+
+}
@@ -0,0 +1,115 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullShader.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+#include "rbpch.h"
+#include "NullShader.h"
+
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+	static std::string NameFromPath(const std::string& filepath)
+	{
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		return filepath.substr(lastSlash, count);
+	}
+
+	NullShader::NullShader(const std::string& filepath, const ShaderDefines& defines) :
+		mId(NullCommandLog::NextResourceId()), mName(NameFromPath(filepath))
+	{
+		std::string variant = GetVariantName(defines);
+		if (!variant.empty())
+			mName += "[" + variant + "]";
+	}
+
+	NullShader::NullShader(const std::string& vertexPath, const std::string& pixelPath) :
+		mId(NullCommandLog::NextResourceId()), mName(NameFromPath(vertexPath))
+	{
+	}
+
+	NullShader::NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) :
+		mId(NullCommandLog::NextResourceId()), mName(name)
+	{
+	}
+
+	void NullShader::Bind() const
+	{
+		NullCommandLog::Record(NullCommandType::BIND_SHADER, mId);
+	}
+
+	void NullShader::Unbind() const
+	{
+	}
+
+	void NullShader::SetInt(ShaderUniformHandle uniform, const int value)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(int));
+	}
+
+	void NullShader::SetIntArray(ShaderUniformHandle uniform, const int* values, const uint32 count)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(int) * count);
+	}
+
+	void NullShader::SetFloat(ShaderUniformHandle uniform, const float value)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(float));
+	}
+
+	void NullShader::SetFloat2(ShaderUniformHandle uniform, const glm::vec2& vec)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(glm::vec2));
+	}
+
+	void NullShader::SetFloat3(ShaderUniformHandle uniform, const glm::vec3& vec)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(glm::vec3));
+	}
+
+	void NullShader::SetFloat4(ShaderUniformHandle uniform, const glm::vec4& vec)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(glm::vec4));
+	}
+
+	void NullShader::SetMat3(ShaderUniformHandle uniform, const glm::mat3& matrix)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(glm::mat3));
+	}
+
+	void NullShader::SetMat4(ShaderUniformHandle uniform, const glm::mat4& matrix)
+	{
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, sizeof(glm::mat4));
+	}
+
+	void NullShader::SetUniforms(const ShaderUniformValue* values, const uint32 count)
+	{
+		uint32 size = 0;
+		for (uint32 i = 0; i < count; i++)
+			size += ShaderDataTypeSize(values[i].type) * values[i].count;
+		NullCommandLog::Record(NullCommandType::SET_UNIFORM, mId, size);
+	}
+
+}
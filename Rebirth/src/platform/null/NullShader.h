@@ -0,0 +1,62 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullShader.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "rebirth/renderer/Shader.h"
+
+
+namespace rebirth
+{
+	// Shader that is never compiled, only the binds and uniform uploads are recorded
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(const std::string& filepath, const ShaderDefines& defines = {});
+		NullShader(const std::string& vertexPath, const std::string& pixelPath);
+		NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		~NullShader() override = default;
+
+		void Bind() const override;
+		void Unbind() const override;
+
+		const std::string& GetName() const override { return mName; }
+
+		void Link() override {}
+
+		void SetInt(ShaderUniformHandle uniform, const int value) override;
+		void SetIntArray(ShaderUniformHandle uniform, const int* values, const uint32 count) override;
+		void SetFloat(ShaderUniformHandle uniform, const float value) override;
+		void SetFloat2(ShaderUniformHandle uniform, const glm::vec2& vec) override;
+		void SetFloat3(ShaderUniformHandle uniform, const glm::vec3& vec) override;
+		void SetFloat4(ShaderUniformHandle uniform, const glm::vec4& vec) override;
+		void SetMat3(ShaderUniformHandle uniform, const glm::mat3& matrix) override;
+		void SetMat4(ShaderUniformHandle uniform, const glm::mat4& matrix) override;
+
+		using Shader::SetUniforms;
+		void SetUniforms(const ShaderUniformValue* values, uint32 count) override;
+
+	private:
+		uint32 mId = 0;
+		std::string mName;
+	};
+}
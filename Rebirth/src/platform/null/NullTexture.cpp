@@ -0,0 +1,117 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullTexture.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "NullTexture.h"
+
+#include "NullCommandLog.h"
+#include "rebirth/renderer/CookedTexture.h"
+#include "rebirth/renderer/ImageLoader.h"
+
+namespace rebirth
+{
+
+	NullTexture2D::NullTexture2D(const std::string& path, const bool async) :
+		mId(NullCommandLog::NextResourceId()), mPath(path)
+	{
+		RB_PROFILE_FUNC();
+		if (async)
+			return;
+
+		CookedTexture cooked;
+		std::string cookedPath = CookedTexture::FindCooked(path);
+		if (!cookedPath.empty() && cooked.Open(cookedPath))
+		{
+			mWidth = (int)cooked.GetWidth();
+			mHeight = (int)cooked.GetHeight();
+			mMemorySize = cooked.GetDataSize();
+			mMipLevels = (uint32)cooked.GetLevels().size();
+			mLoaded = true;
+			NullCommandLog::Record(NullCommandType::UPLOAD_TEXTURE, mId, (uint32)mMemorySize);
+			return;
+		}
+
+		int width, height, channels;
+		if (ImageLoader::GetInfo(path, width, height, channels))
+		{
+			mWidth = width;
+			mHeight = height;
+			mChannels = (uint32)channels;
+			mMemorySize = (uint64)width * height * channels;
+			mLoaded = true;
+			NullCommandLog::Record(NullCommandType::UPLOAD_TEXTURE, mId, width * height * channels);
+		}
+		else
+		{
+			RB_CORE_ERROR("Failed to load texture {}", path);
+		}
+	}
+
+	NullTexture2D::NullTexture2D(const uint32 width, const uint32 height) :
+		mWidth((int)width), mHeight((int)height), mId(NullCommandLog::NextResourceId()), mMemorySize((uint64)width * height * 4), mLoaded(true)
+	{
+	}
+
+	void NullTexture2D::Bind(const uint32 slot) const
+	{
+		NullCommandLog::Record(NullCommandType::BIND_TEXTURE, mId, slot);
+	}
+
+	void NullTexture2D::SetData(void* data, uint32 size)
+	{
+		NullCommandLog::Record(NullCommandType::UPLOAD_TEXTURE, mId, size);
+	}
+
+	void NullTexture2D::SetSubData(const void* data, uint32 x, uint32 y, uint32 width, uint32 height)
+	{
+		RB_CORE_ASSERT(x + width <= (uint32)mWidth && y + height <= (uint32)mHeight, "Sub data is out of the texture's bounds");
+		NullCommandLog::Record(NullCommandType::UPLOAD_TEXTURE, mId, width * height * 4);
+	}
+
+	bool NullTexture2D::ReadPixels(std::vector<byte>& outData) const
+	{
+		if (!mWidth || !mHeight)
+			return false;
+
+		outData.assign(mWidth * mHeight * 4, 0xff);
+		return true;
+	}
+
+	void NullTexture2D::BeginUpload(const uint32 width, const uint32 height, const uint32 channels)
+	{
+		mWidth = (int)width;
+		mHeight = (int)height;
+		mChannels = channels;
+		mMemorySize = (uint64)width * height * channels;
+	}
+
+	void NullTexture2D::UploadRows(const byte* pixels, const uint32 firstRow, const uint32 rowCount)
+	{
+		NullCommandLog::Record(NullCommandType::UPLOAD_TEXTURE, mId, mWidth * rowCount * mChannels);
+	}
+
+	void NullTexture2D::EndUpload()
+	{
+		mLoaded = true;
+	}
+
+}
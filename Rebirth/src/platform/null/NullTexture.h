@@ -0,0 +1,83 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullTexture.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "rebirth/renderer/Texture.h"
+
+namespace rebirth
+{
+	// Only reads the image header for its dimensions, pixel data is never decoded
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		// An async texture only records its uploads once the TextureStreamer feeds them
+		NullTexture2D(const std::string& path, bool async = false);
+		NullTexture2D(uint32 width, uint32 height);
+		~NullTexture2D() override = default;
+
+		void Bind(uint32 slot = 0) const override;
+
+		void SetData(void* data, uint32 size) override;
+		void SetSubData(const void* data, uint32 x, uint32 y, uint32 width, uint32 height) override;
+		bool ReadPixels(std::vector<byte>& outData) const override;
+
+		int GetWidth() const override
+		{
+			return mWidth;
+		}
+
+		int GetHeight() const override
+		{
+			return mHeight;
+		}
+
+		uint32 GetId() const override { return mId; }
+
+		const std::string& GetPath() const override { return mPath; }
+		uint32 GetMipLevels() const override { return mMipLevels; }
+		uint64 GetMemorySize() const override { return mLoaded ? mMemorySize : 0; }
+
+		bool IsLoaded() const override { return mLoaded; }
+
+		bool operator==(const Texture& other) const override
+		{
+			return mId == other.GetId();
+		}
+
+	protected:
+		void BeginUpload(uint32 width, uint32 height, uint32 channels) override;
+		void UploadRows(const byte* pixels, uint32 firstRow, uint32 rowCount) override;
+		void EndUpload() override;
+
+	private:
+		int mWidth = 0;
+		int mHeight = 0;
+		uint32 mId;
+		uint32 mChannels = 4;
+		uint64 mMemorySize = 0;
+		uint32 mMipLevels = 1;
+		bool mLoaded = false;
+
+		std::string mPath;
+	};
+}
@@ -0,0 +1,42 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullUniformBuffer.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "NullUniformBuffer.h"
+
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+
+	NullUniformBuffer::NullUniformBuffer(uint32 size, uint32 binding) :
+		mId(NullCommandLog::NextResourceId()), mSize(size), mBinding(binding)
+	{
+	}
+
+	void NullUniformBuffer::SetData(const void* data, uint32 size, uint32 offset)
+	{
+		RB_CORE_ASSERT(offset + size <= mSize, "Uniform buffer upload is out of range");
+		NullCommandLog::Record(NullCommandType::UPLOAD_UNIFORM_BUFFER, mId, size);
+	}
+
+}
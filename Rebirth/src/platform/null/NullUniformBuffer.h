@@ -0,0 +1,42 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullUniformBuffer.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "rebirth/renderer/UniformBuffer.h"
+
+namespace rebirth
+{
+	class NullUniformBuffer : public UniformBuffer
+	{
+	public:
+		NullUniformBuffer(uint32 size, uint32 binding);
+		~NullUniformBuffer() override = default;
+
+		void SetData(const void* data, uint32 size, uint32 offset = 0) override;
+
+	private:
+		uint32 mId = 0;
+		uint32 mSize = 0;
+		uint32 mBinding = 0;
+	};
+}
@@ -0,0 +1,58 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullVertexArray.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+
+
+#include "rbpch.h"
+#include "NullVertexArray.h"
+
+#include "NullCommandLog.h"
+
+namespace rebirth
+{
+
+	NullVertexArray::NullVertexArray() :
+		mId(NullCommandLog::NextResourceId())
+	{
+	}
+
+	void NullVertexArray::Bind() const
+	{
+		NullCommandLog::Record(NullCommandType::BIND_VERTEX_ARRAY, mId);
+	}
+
+	void NullVertexArray::Unbind() const
+	{
+	}
+
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& buffer)
+	{
+		RB_CORE_ASSERT(buffer->GetLayout().GetElements().size(), "Vertex buffer has no layout");
+		mVertexBuffers.push_back(buffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& buffer)
+	{
+		mIndexBuffer = buffer;
+	}
+
+}
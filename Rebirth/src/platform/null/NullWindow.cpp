@@ -0,0 +1,38 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullWindow.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+
+#include "NullWindow.h"
+
+namespace rebirth
+{
+
+	NullWindow::NullWindow(const ApplicationDesc& props) :
+		mWidth(props.windowWidth),
+		mHeight(props.windowHeight),
+		mVSync(props.flags & WindowFlag_VSync)
+	{
+		RB_CORE_INFO("Creating headless window {0} ({1}, {2})", props.title, mWidth, mHeight);
+	}
+
+}
@@ -0,0 +1,55 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: NullWindow.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "rebirth/core/Window.h"
+
+namespace rebirth
+{
+	// Window stand-in for headless runs, there is no surface, context or input behind it
+	class NullWindow : public Window
+	{
+	public:
+		NullWindow(const ApplicationDesc& props);
+
+		void OnUpdate() override {}
+
+		uint32 GetWidth() const override { return mWidth; }
+		uint32 GetHeight() const override { return mHeight; }
+
+		void SetEventCallback(const EventCallbackFn& callback) override { mEventCallback = callback; }
+
+		void SetVSync(bool enabled) override { mVSync = enabled; }
+		bool IsVSync() const override { return mVSync; }
+
+		float GetHighDPIScaleFactor() const override { return 1.0f; }
+
+		void* GetNativeWindow() const override { return nullptr; }
+		GraphicsContext* GetContext() const override { return nullptr; }
+	private:
+		uint32 mWidth;
+		uint32 mHeight;
+		bool mVSync;
+		EventCallbackFn mEventCallback;
+	};
+}
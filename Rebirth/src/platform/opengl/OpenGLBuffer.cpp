@@ -24,6 +24,7 @@
 
 #include "rbpch.h"
 #include "OpenGLBuffer.h"
+#include "rebirth/renderer/RenderThread.h"
 
 #include <glad/glad.h>
 
@@ -38,43 +39,134 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		glCreateBuffers(1, &mId);
-		glBindBuffer(GL_ARRAY_BUFFER, mId);
-		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+		RenderThread::Invoke([this, size]()
+			{
+				glCreateBuffers(1, &mId);
+				glBindBuffer(GL_ARRAY_BUFFER, mId);
+				glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+			});
 	}
 
 	OpenGLVertexBuffer::OpenGLVertexBuffer(const uint32 size, float* vertices)
 	{
 		RB_PROFILE_FUNC();
-		glCreateBuffers(1, &mId);
-		glBindBuffer(GL_ARRAY_BUFFER, mId);
-		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+		RenderThread::Invoke([this, size, vertices]()
+			{
+				glCreateBuffers(1, &mId);
+				glBindBuffer(GL_ARRAY_BUFFER, mId);
+				glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+			});
 	}
 
 
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
 		RB_PROFILE_FUNC();
-		glDeleteBuffers(1, &mId);
+		RenderThread::Submit([id = mId]() { glDeleteBuffers(1, &id); });
 	}
 
 	void OpenGLVertexBuffer::Bind() const
 	{
 		RB_PROFILE_FUNC();
-		glBindBuffer(GL_ARRAY_BUFFER, mId);
+		RenderThread::Submit([id = mId]() { glBindBuffer(GL_ARRAY_BUFFER, id); });
 	}
 
 	void OpenGLVertexBuffer::Unbind() const
 	{
 		RB_PROFILE_FUNC();
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		RenderThread::Submit([]() { glBindBuffer(GL_ARRAY_BUFFER, 0); });
 	}
 
 
 	void OpenGLVertexBuffer::SetData(const void* data, uint32 size)
 	{
+		const void* payload = RenderThread::CopyPayload(data, size);
+		RenderThread::Submit([id = mId, payload, size]()
+			{
+				glBindBuffer(GL_ARRAY_BUFFER, id);
+				glBufferSubData(GL_ARRAY_BUFFER, 0, size, payload);
+			});
+	}
+
+	/////////////////////////////////////
+	/// Streaming Vertex Buffer /////////
+	/////////////////////////////////////
+
+	OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(const uint32 regionSize, const uint32 regionCount) :
+		mRegionSize(regionSize), mRegionCount(regionCount), mFences(regionCount, nullptr)
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(regionCount > 0, "Streaming buffer needs at least one region");
+		RB_CORE_ASSERT(!RenderThread::IsRunning(), "Persistently mapped buffers are written from the recording thread, they can't be used with the render thread");
+
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		GLsizeiptr size = (GLsizeiptr)regionSize * regionCount;
+
+		glCreateBuffers(1, &mId);
+		glNamedBufferStorage(mId, size, nullptr, flags);
+		mMapped = (byte*)glMapNamedBufferRange(mId, 0, size, flags);
+		RB_CORE_ASSERT(mMapped, "Failed to map streaming vertex buffer");
+	}
+
+	OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer()
+	{
+		RB_PROFILE_FUNC();
+		for (void* fence : mFences)
+		{
+			if (fence)
+				glDeleteSync((GLsync)fence);
+		}
+
+		glUnmapNamedBuffer(mId);
+		glDeleteBuffers(1, &mId);
+	}
+
+	void OpenGLStreamingVertexBuffer::Bind() const
+	{
+		RB_PROFILE_FUNC();
 		glBindBuffer(GL_ARRAY_BUFFER, mId);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+	}
+
+	void OpenGLStreamingVertexBuffer::Unbind() const
+	{
+		RB_PROFILE_FUNC();
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLStreamingVertexBuffer::SetData(const void* data, const uint32 size)
+	{
+		RB_CORE_ASSERT(size <= mRegionSize, "Vertex data is larger than a streaming region");
+		memcpy(GetMappedRegion(), data, size);
+	}
+
+	void* OpenGLStreamingVertexBuffer::GetMappedRegion()
+	{
+		WaitForRegion(mRegion);
+		return mMapped + (size_t)mRegion * mRegionSize;
+	}
+
+	void OpenGLStreamingVertexBuffer::NextRegion()
+	{
+		// Fence after the draws reading from this region were issued
+		mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		mRegion = (mRegion + 1) % mRegionCount;
+	}
+
+	void OpenGLStreamingVertexBuffer::WaitForRegion(const uint32 region)
+	{
+		GLsync fence = (GLsync)mFences[region];
+		if (!fence)
+			return;
+
+		RB_PROFILE_FUNC();
+		GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		while (result == GL_TIMEOUT_EXPIRED)
+		{
+			result = glClientWaitSync(fence, 0, 1000000);
+		}
+
+		glDeleteSync(fence);
+		mFences[region] = nullptr;
 	}
 
 	/////////////////////////////////////
@@ -86,27 +178,30 @@ namespace rebirth
 		mCount(count)
 	{
 		RB_PROFILE_FUNC();
-		glCreateBuffers(1, &mId);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mId);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32), indices, GL_STATIC_DRAW);
+		RenderThread::Invoke([this, count, indices]()
+			{
+				glCreateBuffers(1, &mId);
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mId);
+				glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32), indices, GL_STATIC_DRAW);
+			});
 	}
 
 	OpenGLIndexBuffer::~OpenGLIndexBuffer()
 	{
 		RB_PROFILE_FUNC();
-		glDeleteBuffers(1, &mId);
+		RenderThread::Submit([id = mId]() { glDeleteBuffers(1, &id); });
 	}
 
 	void OpenGLIndexBuffer::Bind() const
 	{
 		RB_PROFILE_FUNC();
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mId);
+		RenderThread::Submit([id = mId]() { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id); });
 	}
 
 	void OpenGLIndexBuffer::Unbind() const
 	{
 		RB_PROFILE_FUNC();
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		RenderThread::Submit([]() { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
 	}
 
 }
\ No newline at end of file
@@ -54,6 +54,45 @@ namespace rebirth
 		BufferLayout mLayout;
 	};
 
+	// Persistently mapped with glBufferStorage, each region is guarded by a fence so
+	// it is only written again once the GPU has finished drawing from it
+	class OpenGLStreamingVertexBuffer : public VertexBuffer
+	{
+	public:
+		OpenGLStreamingVertexBuffer(uint32 regionSize, uint32 regionCount);
+		~OpenGLStreamingVertexBuffer() override;
+		void Bind() const override;
+		void Unbind() const override;
+
+		void SetLayout(const BufferLayout& layout) override
+		{
+			mLayout = layout;
+		}
+
+		const BufferLayout& GetLayout() const override
+		{
+			return mLayout;
+		}
+
+		void SetData(const void* data, uint32 size) override;
+
+		bool IsStreaming() const override { return true; }
+		void* GetMappedRegion() override;
+		uint32 GetRegionOffset() const override { return mRegion * mRegionSize; }
+		void NextRegion() override;
+
+	private:
+		void WaitForRegion(uint32 region);
+
+		uint32 mId;
+		uint32 mRegionSize;
+		uint32 mRegionCount;
+		uint32 mRegion = 0;
+		byte* mMapped = nullptr;
+		std::vector<void*> mFences; // GLsync per region
+		BufferLayout mLayout;
+	};
+
 	class OpenGLIndexBuffer : public IndexBuffer
 	{
 	public:
@@ -84,4 +84,14 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		glfwSwapBuffers(mWindow);
 	}
+
+	void OpenGLContext::MakeCurrent()
+	{
+		glfwMakeContextCurrent(mWindow);
+	}
+
+	void OpenGLContext::ReleaseCurrent()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
 }
\ No newline at end of file
@@ -38,6 +38,9 @@ namespace rebirth
 		void Init() override;
 		void SwapBuffers() override;
 
+		void MakeCurrent() override;
+		void ReleaseCurrent() override;
+
 	private:
 		GLFWwindow* mWindow;
 	};
@@ -23,6 +23,7 @@
 
 #include "rbpch.h"
 #include "OpenGLFramebuffer.h"
+#include "rebirth/renderer/RenderThread.h"
 
 #include <glad/glad.h>
 
@@ -133,16 +134,20 @@ namespace rebirth
 			else
 				mDepthAttachmentDesc = format;
 		}
-		Invalidate();
+		RenderThread::Invoke([this]() { Invalidate(); });
 	}
 
 	OpenGLFramebuffer::~OpenGLFramebuffer()
 	{
-		glDeleteFramebuffers(1, &mId);
-		glDeleteTextures((GLsizei)mColorAttachments.size(), mColorAttachments.data());
-		glDeleteTextures(1, &mDepthAttachment);
+		RenderThread::Submit([id = mId, colorAttachments = mColorAttachments, depthAttachment = mDepthAttachment]()
+			{
+				glDeleteFramebuffers(1, &id);
+				glDeleteTextures((GLsizei)colorAttachments.size(), colorAttachments.data());
+				glDeleteTextures(1, &depthAttachment);
+			});
 	}
 
+	// Runs on the render thread, recreates the attachments so the ids change
 	void OpenGLFramebuffer::Invalidate()
 	{
 		RB_PROFILE_FUNC();
@@ -218,13 +223,16 @@ namespace rebirth
 
 	void OpenGLFramebuffer::Bind()
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, mId);
-		glViewport(0, 0, mDesc.width, mDesc.height);
+		RenderThread::Submit([id = mId, width = mDesc.width, height = mDesc.height]()
+			{
+				glBindFramebuffer(GL_FRAMEBUFFER, id);
+				glViewport(0, 0, width, height);
+			});
 	}
 
 	void OpenGLFramebuffer::Unbind()
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		RenderThread::Submit([]() { glBindFramebuffer(GL_FRAMEBUFFER, 0); });
 	}
 
 
@@ -237,7 +245,9 @@ namespace rebirth
 		}
 		mDesc.width = width;
 		mDesc.height = height;
-		Invalidate();
+
+		// Waits for the frame in flight, which may still be drawing into the old attachments
+		RenderThread::Invoke([this]() { Invalidate(); });
 	}
 
 	int OpenGLFramebuffer::ReadPixel(uint32 attachmentIndex, int x, int y)
@@ -246,9 +256,14 @@ namespace rebirth
 
 		RB_CORE_ASSERT(attachmentIndex < mColorAttachments.size());
 
-		glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+		// With the render thread running this reads the last frame that finished executing
 		int pixelData;
-		glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, &pixelData);
+		RenderThread::Invoke([this, attachmentIndex, x, y, &pixelData]()
+			{
+				glBindFramebuffer(GL_READ_FRAMEBUFFER, mId);
+				glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+				glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, &pixelData);
+			});
 
 		return pixelData;
 	}
@@ -258,7 +273,10 @@ namespace rebirth
 		RB_CORE_ASSERT(attachmentIndex < mColorAttachments.size());
 		auto& desc = mColorAttachmentDesc[attachmentIndex];
 
-		glClearTexImage(mColorAttachments[attachmentIndex], 0, GetGlFormat(desc.textureFormat), GL_INT, &value);
+		RenderThread::Submit([id = mColorAttachments[attachmentIndex], format = GetGlFormat(desc.textureFormat), value]()
+			{
+				glClearTexImage(id, 0, format, GL_INT, &value);
+			});
 	}
 
 }
\ No newline at end of file
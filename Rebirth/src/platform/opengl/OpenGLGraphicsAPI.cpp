@@ -23,6 +23,8 @@
 #include "rbpch.h"
 
 #include "OpenGLGraphicsAPI.h"
+#include "rebirth/renderer/RenderThread.h"
+#include "OpenGLShaderPack.h"
 
 #include <glad/glad.h>
 
@@ -34,49 +36,91 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glEnable(GL_DEPTH_TEST);
-		glEnable(GL_LINE_SMOOTH);
+		RenderThread::Invoke([]()
+			{
+				glEnable(GL_BLEND);
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+				glEnable(GL_DEPTH_TEST);
+				glEnable(GL_LINE_SMOOTH);
 
+				auto& capabilities = GraphicsAPI::GetCapabilities();
+				capabilities.version = (const char*)glGetString(GL_VERSION);
+				capabilities.renderer = (const char*)glGetString(GL_RENDERER);
+				capabilities.vendor = (const char*)glGetString(GL_VENDOR);
+
+				glGetIntegerv(GL_MAX_SAMPLES, &capabilities.maxSamples);
+				glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &capabilities.maxAniostropy);
+
+				GLint extensionCount = 0;
+				glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+				for (GLint i = 0; i < extensionCount; i++)
+				{
+					if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), "GL_EXT_texture_compression_s3tc") == 0)
+						capabilities.textureCompression = true;
+				}
+			});
+
+		// Mapped regions are written while recording, the render thread would need to fence them
 		auto& capabilities = GraphicsAPI::GetCapabilities();
-		capabilities.version = (const char*)glGetString(GL_VERSION);
-		capabilities.renderer = (const char*)glGetString(GL_RENDERER);
-		capabilities.vendor = (const char*)glGetString(GL_VENDOR);
+		capabilities.persistentMapping = GLAD_GL_VERSION_4_4 != 0 && !RenderThread::IsRunning();
 
-		glGetIntegerv(GL_MAX_SAMPLES, &capabilities.maxSamples);
-		glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &capabilities.maxAniostropy);
+		// Shaders that aren't in the pack are compiled as usual
+		if (!OpenGLShaderPack::Load(OpenGLShaderPack::DEFAULT_PATH))
+		{
+#ifdef RB_NO_SHADER_COMPILER
+			RB_CORE_ERROR("No shader pack at {} and this build can't compile shaders", OpenGLShaderPack::DEFAULT_PATH);
+#else
+			RB_CORE_INFO("No shader pack at {}, compiling shaders at runtime", OpenGLShaderPack::DEFAULT_PATH);
+#endif
+		}
 	}
 
 	void OpenGLGraphicsAPI::SetViewport(const uint32 x, const uint32 y, const uint32 width, const uint32 height)
 	{
-		glViewport(x, y, width, height);
+		RenderThread::Submit([x, y, width, height]() { glViewport(x, y, width, height); });
 	}
 
 	void OpenGLGraphicsAPI::SetClearColor(const glm::vec4& color)
 	{
-		glClearColor(color.r, color.g, color.b, color.a);
+		RenderThread::Submit([color]() { glClearColor(color.r, color.g, color.b, color.a); });
 	}
 
 	void OpenGLGraphicsAPI::Clear()
 	{
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		RenderThread::Submit([]() { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); });
 	}
 
-	void OpenGLGraphicsAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 count)
+	void OpenGLGraphicsAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 count, uint32 vertexOffset)
 	{
 		uint32 indexCount = count ? count : vertexArray->GetIndexBuffer()->GetCount();
-		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+		RenderThread::Submit([indexCount, vertexOffset]()
+			{
+				if (vertexOffset)
+					glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, vertexOffset);
+				else
+					glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+			});
+	}
+
+	void OpenGLGraphicsAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32 indexCount, uint32 instanceCount, uint32 instanceOffset)
+	{
+		RenderThread::Submit([indexCount, instanceCount, instanceOffset]()
+			{
+				if (instanceOffset)
+					glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount, instanceOffset);
+				else
+					glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+			});
 	}
 
-	void OpenGLGraphicsAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount)
+	void OpenGLGraphicsAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount, uint32 vertexOffset)
 	{
-		glDrawArrays(GL_LINES, 0, vertexCount);
+		RenderThread::Submit([vertexCount, vertexOffset]() { glDrawArrays(GL_LINES, vertexOffset, vertexCount); });
 	}
 
 	void OpenGLGraphicsAPI::SetLineWidth(float width)
 	{
-		glLineWidth(width);
+		RenderThread::Submit([width]() { glLineWidth(width); });
 	}
 
 }
\ No newline at end of file
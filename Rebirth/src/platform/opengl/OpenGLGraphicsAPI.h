@@ -32,9 +32,10 @@ namespace rebirth
 		void SetViewport(uint32 x, uint32 y, uint32 width, uint32 height) override;
 		void SetClearColor(const glm::vec4& color) override;
 		void Clear() override;
-		void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 count = 0) override;
+		void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 count = 0, uint32 vertexOffset = 0) override;
+		void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32 indexCount, uint32 instanceCount, uint32 instanceOffset = 0) override;
 
-		void DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount) override;
+		void DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount, uint32 vertexOffset = 0) override;
 
 
 		void SetLineWidth(float width) override;
@@ -22,15 +22,24 @@
 // ------------------------------------------------------------------------------
 #include "rbpch.h"
 #include "OpenGLShader.h"
+#include "rebirth/core/JobSystem.h"
 
 #include <fstream>
 
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
+#ifndef RB_NO_SHADER_COMPILER
 #include <shaderc/shaderc.hpp>
 #include <spirv_cross/spirv_cross.hpp>
 #include <spirv_cross/spirv_glsl.hpp>
+#include <vulkan/vulkan_core.h>
+#endif
 #include "rebirth/core/Application.h"
+#include "rebirth/core/Pack.h"
+#include "rebirth/renderer/RenderThread.h"
+#include "rebirth/renderer/GraphicsAPI.h"
+#include "OpenGLShaderCache.h"
+#include "OpenGLShaderPack.h"
 
 #ifndef GLSL_MAX_SHADERS_PER_FILE
 #	define GLSL_MAX_SHADERS_PER_FILE 2
@@ -47,6 +56,7 @@ namespace rebirth
 		return 0;
 	}
 
+#ifndef RB_NO_SHADER_COMPILER
 	static shaderc_shader_kind GLShaderStageToShaderC(GLenum stage)
 	{
 		switch (stage)
@@ -58,6 +68,7 @@ namespace rebirth
 		RB_CORE_ASSERT(false);
 		return (shaderc_shader_kind)0;
 	}
+#endif
 
 	static const char* GLShaderStageToString(GLenum stage)
 	{
@@ -71,95 +82,162 @@ namespace rebirth
 		return nullptr;
 	}
 
-	static const char* GetCacheDirectory()
+	// Program binaries only load on the driver that produced them
+	static void AddDriver(ShaderHasher& hasher)
 	{
-		return "assets/cache/shader/opengl";
+		const auto& capabilities = GraphicsAPI::GetCapabilities();
+		hasher.Add(capabilities.vendor);
+		hasher.Add(capabilities.renderer);
+		hasher.Add(capabilities.version);
 	}
 
-	static const char* GLShaderStageCachedOpenGLFileExtension(GLenum stage)
+	// Without a context, as in the shader cook, there's no driver to load a program binary into
+	static bool HasDriver()
 	{
-		switch (stage)
+		return !GraphicsAPI::GetCapabilities().version.empty();
+	}
+
+	// What a shader is built from, a cooked shader is only used while this still matches
+	static uint64 MakeSourceHash(const std::string& variant, const std::unordered_map<uint32, std::string>& sources)
+	{
+		ShaderHasher hasher;
+		hasher.Add(variant);
+
+		std::vector<uint32> stages;
+		for (auto&& [stage, stageSource] : sources)
+			stages.push_back(stage);
+		std::sort(stages.begin(), stages.end());
+
+		for (uint32 stage : stages)
 		{
-			case GL_VERTEX_SHADER: return ".cached_opengl.vert";
-			case GL_FRAGMENT_SHADER: return ".cached_opengl.frag";
+			hasher.Add(stage);
+			hasher.Add(sources.at(stage));
 		}
-
-		RB_CORE_ASSERT(false);
-		return nullptr;
+		return hasher.Get();
 	}
 
-	static const char* GLShaderStageCachedVulkanFileExtension(GLenum stage)
+	// Cooked SPIR-V is already final, so it stands in for the source and toolchain
+	static uint64 MakePackedProgramKey(const CookedShader& shader)
 	{
-		switch (stage)
+		ShaderHasher hasher;
+		hasher.Add(shader.name);
+		AddDriver(hasher);
+		for (const auto& stage : shader.stages)
 		{
-			case GL_VERTEX_SHADER: return ".cached_vulkan.vert";
-			case GL_FRAGMENT_SHADER: return ".cached_vulkan.frag";
+			hasher.Add(stage.stage);
+			hasher.Add(stage.spirv.data(), stage.spirv.size() * sizeof(uint32));
 		}
+		return hasher.Get();
+	}
 
-		RB_CORE_ASSERT(false);
-		return nullptr;
+#ifndef RB_NO_SHADER_COMPILER
+	struct CompileTarget
+	{
+		const char* name;
+		shaderc_target_env env;
+		uint32 envVersion;
+		shaderc_optimization_level optimization;
+	};
+
+	static constexpr CompileTarget sVulkanTarget = { "vulkan", shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2, shaderc_optimization_level_performance };
+	static constexpr CompileTarget sOpenGLTarget = { "opengl", shaderc_target_env_opengl, shaderc_env_version_opengl_4_5, shaderc_optimization_level_performance };
+
+	static shaderc::CompileOptions MakeCompileOptions(const CompileTarget& target, const ShaderDefines& defines = {})
+	{
+		shaderc::CompileOptions options;
+		options.SetTargetEnvironment(target.env, target.envVersion);
+		options.SetOptimizationLevel(target.optimization);
+		for (const auto& define : defines)
+			options.AddMacroDefinition(define.name, define.value);
+		return options;
 	}
 
-	static void CreateCacheDirectory()
+	// Compiler versions and settings, anything built by a different SDK or with other options has to miss
+	static void AddToolchain(ShaderHasher& hasher, const CompileTarget& target)
 	{
-		static int count = 0;
-		std::string cacheDir = GetCacheDirectory();
-		if (!std::filesystem::exists(cacheDir))
-			std::filesystem::create_directories(cacheDir);
-		else if (count == 0)
-		{
-			auto args = Application::Instance().GetCommandLineArgs();
-			if (args.count > 1)
-			{
-				for (int i = 1; i < args.count; i++)
-				{
-					std::string arg = args[i];
-					if (arg == "-f" || arg == "-F" || arg == "--force-shader-compile")
-					{
-						RB_CORE_TRACE("force-shader-compile command line argument detected, deleting cached shaders and recompiling");
-						std::filesystem::remove_all(cacheDir);
-						std::filesystem::create_directories(cacheDir);
-						break;
-					}
-				}
-			}
-			count++;
-		}
+		hasher.Add(target.env);
+		hasher.Add(target.envVersion);
+		hasher.Add(target.optimization);
+
+		// shaderc and SPIRV-Cross both come with the Vulkan SDK
+		uint32 spvVersion = 0, spvRevision = 0;
+		shaderc_get_spv_version(&spvVersion, &spvRevision);
+		hasher.Add(spvVersion);
+		hasher.Add(spvRevision);
+		hasher.Add((uint32)VK_HEADER_VERSION_COMPLETE);
 	}
 
-	OpenGLShader::OpenGLShader(const std::string& filepath) :
-		mFilepath(filepath)
+	// Hashes the compiler input together with everything else that changes its output
+	static uint64 MakeCacheKey(const CompileTarget& target, const std::string& source, const std::string& variant, const uint32 stage, const void* input, const size_t size)
 	{
-		RB_PROFILE_FUNC();
+		ShaderHasher hasher;
+		hasher.Add(source);
+		hasher.Add(variant);
+		hasher.Add(stage);
+		AddToolchain(hasher, target);
+		hasher.Add(input, size);
+		return hasher.Get();
+	}
 
-		CreateCacheDirectory();
+	// Computed straight from the stage sources so a hit needs neither shaderc nor SPIRV-Cross
+	static uint64 MakeProgramKey(const std::string& source, const std::string& variant, const std::unordered_map<uint32, std::string>& sources)
+	{
+		ShaderHasher hasher;
+		hasher.Add(source);
+		hasher.Add(variant);
+		AddToolchain(hasher, sVulkanTarget);
+		AddToolchain(hasher, sOpenGLTarget);
+		AddDriver(hasher);
+
+		std::vector<uint32> stages;
+		for (auto&& [stage, stageSource] : sources)
+			stages.push_back(stage);
+		std::sort(stages.begin(), stages.end());
 
-		std::string src = Read(filepath);
-		auto sources = Preprocess(src);
+		for (uint32 stage : stages)
+		{
+			hasher.Add(stage);
+			hasher.Add(sources.at(stage));
+		}
+		return hasher.Get();
+	}
+#endif
 
-		CompileOrGetVulkanBinaries(sources);
-		CompileOrGetOpenGLBinaries();
-		CreateProgram();
+	static bool ProgramBinariesSupported()
+	{
+		GLint formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		return formats > 0;
+	}
+
+	OpenGLShader::OpenGLShader(const std::string& filepath, const ShaderDefines& defines) :
+		mFilepath(filepath), mDefines(defines), mVariant(GetVariantName(defines))
+	{
+		RB_PROFILE_FUNC();
 
 		auto lastSlash = filepath.find_last_of("/\\");
 		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
 		auto lastDot = filepath.rfind('.');
 		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
 		mName = filepath.substr(lastSlash, count);
+		if (!mVariant.empty())
+			mName += "[" + mVariant + "]";
+
+		LoadOrCompile([&]() { return Preprocess(Read(filepath)); });
 	}
 
 	OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) :
 		mName(name)
 	{
 		RB_PROFILE_FUNC();
-		std::unordered_map<uint32, std::string> sources;
-		sources[GL_VERTEX_SHADER] = vertexSrc;
-		sources[GL_FRAGMENT_SHADER] = fragmentSrc;
-
 
-		CompileOrGetVulkanBinaries(sources);
-		CompileOrGetOpenGLBinaries();
-		CreateProgram();
+		LoadOrCompile([&]()
+			{
+				std::unordered_map<uint32, std::string> sources;
+				sources[GL_VERTEX_SHADER] = vertexSrc;
+				sources[GL_FRAGMENT_SHADER] = fragmentSrc;
+				return sources;
+			});
 	}
 
 
@@ -168,13 +246,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		CreateCacheDirectory();
-
-		std::string vertSrc = Read(vertexPath);
-		std::string fragSrc = Read(pixelPath);
-		std::unordered_map<uint32, std::string> sources;
-		sources[GL_VERTEX_SHADER] = vertSrc;
-		sources[GL_FRAGMENT_SHADER] = fragSrc;
 		auto lastSlash = vertexPath.find_last_of("/\\");
 		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
 		auto lastDot = vertexPath.rfind('.');
@@ -183,28 +254,40 @@ namespace rebirth
 
 		mFilepath = mName;
 
-		CompileOrGetVulkanBinaries(sources);
-		CompileOrGetOpenGLBinaries();
-		CreateProgram();
-
+		LoadOrCompile([&]()
+			{
+				std::unordered_map<uint32, std::string> sources;
+				sources[GL_VERTEX_SHADER] = Read(vertexPath);
+				sources[GL_FRAGMENT_SHADER] = Read(pixelPath);
+				return sources;
+			});
 	}
 
 	OpenGLShader::~OpenGLShader()
 	{
 		RB_PROFILE_FUNC();
-		glDeleteShader(mId);
+		// Never linked, e.g. shaders built by the cook tools, which have no context to delete anything with
+		if (mId)
+			RenderThread::Submit([id = mId]() { glDeleteProgram(id); });
+	}
+
+	void OpenGLShader::Link()
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!mId, "Shader {} is already linked", mName);
+		RenderThread::Invoke([this]() { CreateProgram(); });
 	}
 
 	void OpenGLShader::Bind() const
 	{
 		RB_PROFILE_FUNC();
-		glUseProgram(mId);
+		RenderThread::Submit([id = mId]() { glUseProgram(id); });
 	}
 
 	void OpenGLShader::Unbind() const
 	{
 		RB_PROFILE_FUNC();
-		glUseProgram(0);
+		RenderThread::Submit([]() { glUseProgram(0); });
 	}
 
 
@@ -213,6 +296,13 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		RB_CORE_INFO("Loading shader file [{}]", filepath);
 		std::string result;
+		PackView view;
+		if (Pack::Read(filepath, view))
+		{
+			RB_CORE_INFO("Shader file read from the asset pack");
+			return std::string(view.AsString());
+		}
+
 		std::ifstream in(filepath, std::ios::in | std::ios::binary);
 		if (in)
 		{
@@ -231,6 +321,60 @@ namespace rebirth
 		return result;
 	}
 
+	// Builds without a compiler never read the sources, the shader has to be in the pack
+	void OpenGLShader::LoadOrCompile(const std::function<std::unordered_map<uint32, std::string>()>& getSources)
+	{
+#ifdef RB_NO_SHADER_COMPILER
+		if (!LoadFromPack(0))
+			RB_CORE_ERROR("Shader {} isn't in the shader pack and this build can't compile shaders", mName);
+#else
+		auto sources = getSources();
+		mSourceHash = MakeSourceHash(mVariant, sources);
+		if (LoadFromPack(mSourceHash))
+			return;
+
+		Compile(sources);
+#endif
+	}
+
+	// A sourceHash of 0 takes whatever the pack has
+	bool OpenGLShader::LoadFromPack(const uint64 sourceHash)
+	{
+		RB_PROFILE_FUNC();
+
+		CookedShader cooked;
+		if (!OpenGLShaderPack::IsLoaded() || !OpenGLShaderPack::Find(mName, cooked))
+			return false;
+
+		if (sourceHash && cooked.sourceHash != sourceHash)
+		{
+			RB_CORE_INFO("Shader {} changed since the pack was cooked, compiling it instead", mName);
+			return false;
+		}
+
+		mSourceHash = cooked.sourceHash;
+		mOpenGLSPIRV.clear();
+		mUniforms.clear();
+		mMissingUniforms.clear();
+		mUniformBuffers.clear();
+		for (auto& stage : cooked.stages)
+			mOpenGLSPIRV[stage.stage] = std::move(stage.spirv);
+		for (const auto& uniform : cooked.uniforms)
+			AddUniform(uniform.name, uniform.location, uniform.count);
+		for (const auto& buffer : cooked.uniformBuffers)
+			AddUniformBuffer(buffer.name, buffer.binding, buffer.size);
+
+		// The program cache works the same as for compiled shaders, the SPIR-V is kept in case the driver rejects it
+		if (HasDriver())
+		{
+			mProgramKey = MakePackedProgramKey(cooked);
+			OpenGLShaderCache::LoadProgram(mProgramKey, mProgramBinaryFormat, mProgramBinary);
+		}
+
+		RB_CORE_INFO("Shader {} loaded from the shader pack", mName);
+		return true;
+	}
+
 	std::unordered_map<uint32, std::string> OpenGLShader::Preprocess(const std::string& src)
 	{
 		RB_PROFILE_FUNC();
@@ -259,122 +403,207 @@ namespace rebirth
 		return sources;
 	}
 
-	void OpenGLShader::CompileOrGetVulkanBinaries(const std::unordered_map<uint32, std::string>& sources)
+#ifndef RB_NO_SHADER_COMPILER
+	void OpenGLShader::Compile(const std::unordered_map<uint32, std::string>& sources)
 	{
 		RB_PROFILE_FUNC();
 
-		shaderc::Compiler compiler;
-		shaderc::CompileOptions options;
-		options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
-		options.SetOptimizationLevel(shaderc_optimization_level_performance);
+		OpenGLShaderCache::Init();
 
-		std::filesystem::path cacheDir = GetCacheDirectory();
-		auto& shaderData = mVulkanSPIRV;
-		shaderData.clear();
-
-		for (auto&& [stage, source] : sources)
+		// A cached program skips everything below, the sources stay around in case the driver rejects it
+		mProgramKey = MakeProgramKey(GetCacheSource(), mVariant, sources);
+		if (HasDriver() && OpenGLShaderCache::LoadProgram(mProgramKey, mProgramBinaryFormat, mProgramBinary))
 		{
-			std::filesystem::path shaderFilepath = mFilepath;
-			std::filesystem::path cachePath = cacheDir / (shaderFilepath.filename().string() + GLShaderStageCachedVulkanFileExtension(stage));
+			mSources = sources;
+			return;
+		}
 
-			std::ifstream in(cachePath, std::ios::in | std::ios::binary);
-			if (in.is_open())
-			{
-				in.seekg(0, std::ios::end);
-				auto size = in.tellg();
-				in.seekg(0, std::ios::beg);
+		CompileStages(sources);
+	}
 
-				auto& data = shaderData[stage];
-				data.resize(size / sizeof(uint32));
-				in.read((char*)data.data(), size);
-			}
-			else
-			{
-				shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, GLShaderStageToShaderC(stage), mFilepath.c_str(), options);
-				if (module.GetCompilationStatus() != shaderc_compilation_status_success)
-				{
-					RB_CORE_ERROR(module.GetErrorMessage());
-					RB_CORE_ASSERT(false, "Failed to compile shader during vulkan stage [{}]", GLShaderStageToString(stage));
-				}
+	void OpenGLShader::CompileStages(const std::unordered_map<uint32, std::string>& sources)
+	{
+		RB_PROFILE_FUNC();
 
-				shaderData[stage] = std::vector<uint32>(module.cbegin(), module.cend());
+		mVulkanSPIRV.clear();
+		mOpenGLSPIRV.clear();
+		mOpenGLsrc.clear();
 
-				std::ofstream out(cachePath, std::ios::out | std::ios::binary);
-				if (out.is_open())
+		// Every stage gets its entries up front, so each worker only writes to its own
+		for (auto&& [stage, source] : sources)
+		{
+			mVulkanSPIRV[stage];
+			mOpenGLSPIRV[stage];
+			mOpenGLsrc[stage];
+		}
+
+		JobCounter compiled;
+		for (auto&& [stage, source] : sources)
+		{
+			const uint32 stageId = stage;
+			const std::string* stageSource = &source;
+			JobSystem::Execute("OpenGLShader::CompileStage", [this, stageId, stageSource]()
 				{
-					auto& data = shaderData[stage];
-					out.write((char*)data.data(), data.size() * sizeof(uint32));
-					out.flush();
-					out.close();
-				}
-			}
+					CompileOrGetVulkanBinary(stageId, *stageSource);
+					CompileOrGetOpenGLBinary(stageId);
+				}, &compiled);
 		}
+		JobSystem::Wait(compiled);
 
-		for (auto&& [stage, data] : shaderData)
+		// The OpenGL binaries are what gets linked, so their bindings and locations are the ones that count
+		mUniforms.clear();
+		mMissingUniforms.clear();
+		mUniformBuffers.clear();
+		for (auto&& [stage, data] : mOpenGLSPIRV)
 		{
 			Reflect(stage, data);
 		}
+
+		const auto& stats = OpenGLShaderCache::GetStats();
+		RB_CORE_INFO("Shader cache: {} hits, {} misses, {} evicted", stats.hits, stats.misses, stats.evicted);
 	}
 
-	void OpenGLShader::CompileOrGetOpenGLBinaries()
+	void OpenGLShader::CompileOrGetVulkanBinary(const uint32 stage, const std::string& source)
 	{
 		RB_PROFILE_FUNC();
 
 		shaderc::Compiler compiler;
-		shaderc::CompileOptions options;
-		options.SetTargetEnvironment(shaderc_target_env_opengl, shaderc_env_version_opengl_4_5);
-		options.SetOptimizationLevel(shaderc_optimization_level_performance);
+		shaderc::CompileOptions options = MakeCompileOptions(sVulkanTarget, mDefines);
 
-		std::filesystem::path cacheDir = GetCacheDirectory();
-		auto& shaderData = mOpenGLSPIRV;
-		shaderData.clear();
-		mOpenGLsrc.clear();
+		const std::string& cacheSource = GetCacheSource();
+		auto& data = mVulkanSPIRV.at(stage);
+
+		// Keyed on the preprocessed source so edits to comments or unused branches don't cause a miss
+		shaderc::PreprocessedSourceCompilationResult preprocessed = compiler.PreprocessGlsl(source, GLShaderStageToShaderC(stage), mFilepath.c_str(), options);
+		std::string keySource = preprocessed.GetCompilationStatus() == shaderc_compilation_status_success
+			? std::string(preprocessed.cbegin(), preprocessed.cend()) : source;
+		uint64 key = MakeCacheKey(sVulkanTarget, cacheSource, mVariant, stage, keySource.data(), keySource.size());
 
-		for (auto&& [stage, spirv] : mVulkanSPIRV)
+		if (OpenGLShaderCache::Load(key, data))
+			return;
+
+		shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, GLShaderStageToShaderC(stage), mFilepath.c_str(), options);
+		if (module.GetCompilationStatus() != shaderc_compilation_status_success)
 		{
-			std::filesystem::path shaderFilepath = mFilepath;
-			std::filesystem::path cachePath = cacheDir / (shaderFilepath.filename().string() + GLShaderStageCachedOpenGLFileExtension(stage));
+			RB_CORE_ERROR(module.GetErrorMessage());
+			RB_CORE_ASSERT(false, "Failed to compile shader during vulkan stage [{}]", GLShaderStageToString(stage));
+		}
 
-			std::ifstream in(cachePath, std::ios::in | std::ios::binary);
-			if (in.is_open())
-			{
-				in.seekg(0, std::ios::end);
-				auto size = in.tellg();
-				in.seekg(0, std::ios::beg);
+		data = std::vector<uint32>(module.cbegin(), module.cend());
+		OpenGLShaderCache::Store(key, cacheSource, mVariant, std::filesystem::is_regular_file(cacheSource), stage, sVulkanTarget.name, data);
+	}
 
-				auto& data = shaderData[stage];
-				data.resize(size / sizeof(uint32));
-				in.read((char*)data.data(), size);
-			}
-			else
-			{
-				spirv_cross::CompilerGLSL glslCompiler(spirv);
-				mOpenGLsrc[stage] = glslCompiler.compile();
-				auto& source = mOpenGLsrc[stage];
+	void OpenGLShader::CompileOrGetOpenGLBinary(const uint32 stage)
+	{
+		RB_PROFILE_FUNC();
 
-				shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, GLShaderStageToShaderC(stage), mFilepath.c_str(), options);
-				if (module.GetCompilationStatus() != shaderc_compilation_status_success)
-				{
-					RB_CORE_ERROR(module.GetErrorMessage());
-					RB_CORE_ASSERT(false, "Failed to compile shader during opengl stage [{}]", GLShaderStageToString(stage));
-				}
+		shaderc::Compiler compiler;
+		shaderc::CompileOptions options = MakeCompileOptions(sOpenGLTarget);
 
-				shaderData[stage] = std::vector<uint32>(module.cbegin(), module.cend());
+		const std::string& cacheSource = GetCacheSource();
+		const auto& spirv = mVulkanSPIRV.at(stage);
+		auto& data = mOpenGLSPIRV.at(stage);
 
-				std::ofstream out(cachePath, std::ios::out | std::ios::binary);
-				if (out.is_open())
-				{
-					auto& data = shaderData[stage];
-					out.write((char*)data.data(), data.size() * sizeof(uint32));
-					out.flush();
-					out.close();
-				}
-			}
+		// The vulkan binary is the input here, a new one always means a new key
+		uint64 key = MakeCacheKey(sOpenGLTarget, cacheSource, mVariant, stage, spirv.data(), spirv.size() * sizeof(uint32));
+
+		if (OpenGLShaderCache::Load(key, data))
+			return;
+
+		spirv_cross::CompilerGLSL glslCompiler(spirv);
+		auto& source = mOpenGLsrc.at(stage);
+		source = glslCompiler.compile();
+
+		shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, GLShaderStageToShaderC(stage), mFilepath.c_str(), options);
+		if (module.GetCompilationStatus() != shaderc_compilation_status_success)
+		{
+			RB_CORE_ERROR(module.GetErrorMessage());
+			RB_CORE_ASSERT(false, "Failed to compile shader during opengl stage [{}]", GLShaderStageToString(stage));
 		}
+
+		data = std::vector<uint32>(module.cbegin(), module.cend());
+		OpenGLShaderCache::Store(key, cacheSource, mVariant, std::filesystem::is_regular_file(cacheSource), stage, sOpenGLTarget.name, data);
+	}
+
+	void OpenGLShader::Cook(CookedShader& outShader) const
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!mOpenGLSPIRV.empty(), "Shader {} has no SPIR-V to cook", mName);
+
+		outShader.name = mName;
+		outShader.sourceHash = mSourceHash;
+
+		outShader.stages.clear();
+		for (auto&& [stage, spirv] : mOpenGLSPIRV)
+		{
+			auto& cookedStage = outShader.stages.emplace_back();
+			cookedStage.stage = stage;
+			cookedStage.spirv = spirv;
+
+			// Only cross compiled when the opengl pass missed the cache
+			auto it = mOpenGLsrc.find(stage);
+			cookedStage.glsl = it != mOpenGLsrc.end() && !it->second.empty() ? it->second : spirv_cross::CompilerGLSL(mVulkanSPIRV.at(stage)).compile();
+		}
+		std::sort(outShader.stages.begin(), outShader.stages.end(), [](const auto& a, const auto& b) { return a.stage < b.stage; });
+
+		outShader.uniforms.clear();
+		for (auto&& [hash, uniform] : mUniforms)
+			outShader.uniforms.push_back(uniform);
+		std::sort(outShader.uniforms.begin(), outShader.uniforms.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+
+		outShader.uniformBuffers.clear();
+		for (auto&& [hash, buffer] : mUniformBuffers)
+			outShader.uniformBuffers.push_back(buffer);
+		std::sort(outShader.uniformBuffers.begin(), outShader.uniformBuffers.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+	}
+#endif
+
+	const std::string& OpenGLShader::GetCacheSource() const
+	{
+		return mFilepath.empty() ? mName : mFilepath;
+	}
+
+	bool OpenGLShader::CreateProgramFromBinary()
+	{
+		RB_PROFILE_FUNC();
+
+		uint32 prog = glCreateProgram();
+		glProgramBinary(prog, mProgramBinaryFormat, mProgramBinary.data(), (GLsizei)mProgramBinary.size());
+		mProgramBinary.clear();
+		mProgramBinary.shrink_to_fit();
+
+		GLint isLinked = 0;
+		glGetProgramiv(prog, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			glDeleteProgram(prog);
+			return false;
+		}
+
+		mId = prog;
+		mSources.clear();
+		ReflectProgram();
+		RB_CORE_INFO("Shader program {} loaded from the program cache", mId);
+		return true;
 	}
 
 	void OpenGLShader::CreateProgram()
 	{
+		if (!mProgramBinary.empty())
+		{
+			if (CreateProgramFromBinary())
+				return;
+
+			// Usually a driver update, the binary gets replaced once the program is rebuilt
+			RB_CORE_WARN("Cached program for {} was rejected by the driver, recompiling", mName);
+#ifndef RB_NO_SHADER_COMPILER
+			// Packed shaders still have their SPIR-V
+			if (mOpenGLSPIRV.empty())
+				CompileStages(mSources);
+#endif
+			mSources.clear();
+		}
+
 		RB_CORE_INFO("Creating glsl shader program");
 		uint32 prog = glCreateProgram();
 		std::vector<GLuint> shaderIds;
@@ -387,6 +616,10 @@ namespace rebirth
 			glAttachShader(prog, id);
 		}
 
+		const bool cacheProgram = ProgramBinariesSupported();
+		if (cacheProgram)
+			glProgramParameteri(prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 		RB_CORE_INFO("Linking shader program {}", prog);
 		glLinkProgram(prog);
 
@@ -419,10 +652,24 @@ namespace rebirth
 			glDeleteShader(id);
 		}
 
+		if (cacheProgram)
+		{
+			GLint length = 0;
+			glGetProgramiv(prog, GL_PROGRAM_BINARY_LENGTH, &length);
+
+			std::vector<byte> binary(length);
+			GLenum format = 0;
+			glGetProgramBinary(prog, length, &length, &format, binary.data());
+			binary.resize(length);
+
+			const std::string& cacheSource = GetCacheSource();
+			OpenGLShaderCache::StoreProgram(mProgramKey, cacheSource, mVariant, std::filesystem::is_regular_file(cacheSource), format, binary);
+		}
 
 		RB_CORE_INFO("Shader program {} successfully compiled", mId);
 	}
 
+#ifndef RB_NO_SHADER_COMPILER
 	void OpenGLShader::Reflect(uint32 stage, const std::vector<uint32>& shaderData)
 	{
 		spirv_cross::Compiler compiler(shaderData);
@@ -448,106 +695,251 @@ namespace rebirth
 			ss << "\n\t\tSize = " << bufferSize;
 			ss << "\n\t\tBinding = " << binding;
 			ss << "\n\t\tMembers = " << memberCount;
+
+			AddUniformBuffer(resource.name, binding, bufferSize);
 		}
 		RB_CORE_TRACE(ss.str());
+
+		// Samplers are the only loose uniforms vulkan glsl allows, without an explicit location they can't be set
+		for (const auto& resource : resources.sampled_images)
+		{
+			const auto& type = compiler.get_type(resource.type_id);
+			uint32 count = type.array.empty() ? 1 : type.array[0];
+			int32 location = compiler.has_decoration(resource.id, spv::DecorationLocation) ? (int32)compiler.get_decoration(resource.id, spv::DecorationLocation) : -1;
+			AddUniform(resource.name, location, count);
+		}
 	}
 
+#endif
 
-	void OpenGLShader::SetInt(const std::string& name, const int value)
+	// For programs loaded from the program cache, there is no SPIR-V to reflect so GL is asked instead
+	void OpenGLShader::ReflectProgram()
 	{
 		RB_PROFILE_FUNC();
-		SetUniformInt(name, value);
+
+		GLint uniformCount = 0;
+		glGetProgramInterfaceiv(mId, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount);
+		for (GLint i = 0; i < uniformCount; i++)
+		{
+			const GLenum properties[] = { GL_NAME_LENGTH, GL_LOCATION, GL_ARRAY_SIZE, GL_BLOCK_INDEX };
+			GLint values[4] = {};
+			glGetProgramResourceiv(mId, GL_UNIFORM, i, 4, properties, 4, nullptr, values);
+
+			// Members of a uniform block are covered by the block
+			if (values[3] != -1)
+				continue;
+
+			std::string name(values[0], '\0');
+			glGetProgramResourceName(mId, GL_UNIFORM, i, values[0], nullptr, name.data());
+			name.resize(name.find('\0') == std::string::npos ? name.size() : name.find('\0'));
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				name.resize(name.size() - 3);
+
+			AddUniform(name, values[1], (uint32)values[2]);
+		}
+
+		GLint blockCount = 0;
+		glGetProgramInterfaceiv(mId, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &blockCount);
+		for (GLint i = 0; i < blockCount; i++)
+		{
+			const GLenum properties[] = { GL_NAME_LENGTH, GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+			GLint values[3] = {};
+			glGetProgramResourceiv(mId, GL_UNIFORM_BLOCK, i, 3, properties, 3, nullptr, values);
+
+			std::string name(values[0], '\0');
+			glGetProgramResourceName(mId, GL_UNIFORM_BLOCK, i, values[0], nullptr, name.data());
+			name.resize(name.find('\0') == std::string::npos ? name.size() : name.find('\0'));
+
+			AddUniformBuffer(name, (uint32)values[1], (uint32)values[2]);
+		}
 	}
 
-	void OpenGLShader::SetIntArray(const std::string& name, const int* values, const uint32 count)
+	void OpenGLShader::AddUniform(const std::string& name, const int32 location, const uint32 count)
 	{
-		RB_PROFILE_FUNC();
-		SetUniformIntArray(name, values, count);
+		uint32 hash = ShaderUniformHandle::Hash(name);
+		auto it = mUniforms.find(hash);
+		RB_CORE_ASSERT(it == mUniforms.end() || it->second.name == name, "Uniforms {} and {} hash to the same handle", name, it->second.name);
+		mUniforms[hash] = { name, location, count };
 	}
 
-	void OpenGLShader::SetFloat(const std::string& name, const float value)
+	void OpenGLShader::AddUniformBuffer(const std::string& name, const uint32 binding, const uint32 size)
 	{
-		RB_PROFILE_FUNC();
-		SetUniformFloat(name, value);
+		uint32 hash = ShaderUniformHandle::Hash(name);
+		auto it = mUniformBuffers.find(hash);
+		RB_CORE_ASSERT(it == mUniformBuffers.end() || it->second.name == name, "Uniform buffers {} and {} hash to the same handle", name, it->second.name);
+		mUniformBuffers[hash] = { name, binding, size };
 	}
 
-	void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& vec)
+	const OpenGLShader::UniformInfo* OpenGLShader::FindUniform(const ShaderUniformHandle uniform) const
 	{
-		RB_PROFILE_FUNC();
-		SetUniformVec2(name, vec);
+		auto it = mUniforms.find(uniform.hash);
+		return it != mUniforms.end() ? &it->second : nullptr;
 	}
 
-	void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& vec)
+	const OpenGLShader::UniformBufferInfo* OpenGLShader::FindUniformBuffer(const ShaderUniformHandle block) const
 	{
-		RB_PROFILE_FUNC();
-		SetUniformVec3(name, vec);
+		auto it = mUniformBuffers.find(block.hash);
+		return it != mUniformBuffers.end() ? &it->second : nullptr;
 	}
 
-	void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& vec)
+	// Locations are resolved on the recording thread, so the recorded command is a single glProgramUniform call
+	int32 OpenGLShader::GetLocation(const ShaderUniformHandle uniform) const
 	{
-		RB_PROFILE_FUNC();
-		SetUniformVec4(name, vec);
+		const auto* info = FindUniform(uniform);
+		if (info && info->location >= 0)
+			return info->location;
+
+		// Only samplers and uniform blocks are reflected, anything else set by name is dropped
+		if (mMissingUniforms.insert(uniform.hash).second)
+		{
+			if (info)
+			{
+				RB_CORE_WARN("Shader {} uniform {} has no explicit location, setting it is ignored", mName, info->name);
+			}
+			else
+			{
+				RB_CORE_WARN("Shader {} has no reflected uniform with hash {:#x}, plain uniforms must be moved into a uniform block", mName, uniform.hash);
+			}
+		}
+		return -1;
 	}
 
-	void OpenGLShader::SetMat3(const std::string& name, const glm::mat3& matrix)
+	static void UploadUniform(const uint32 program, const int32 location, const ShaderDataType type, const uint32 count, const void* data)
 	{
-		RB_PROFILE_FUNC();
-		SetUniformMat3(name, matrix);
+		switch (type)
+		{
+			case ShaderDataType::INT:		glProgramUniform1iv(program, location, count, (const GLint*)data); break;
+			case ShaderDataType::FLOAT:		glProgramUniform1fv(program, location, count, (const GLfloat*)data); break;
+			case ShaderDataType::FLOAT2:	glProgramUniform2fv(program, location, count, (const GLfloat*)data); break;
+			case ShaderDataType::FLOAT3:	glProgramUniform3fv(program, location, count, (const GLfloat*)data); break;
+			case ShaderDataType::FLOAT4:	glProgramUniform4fv(program, location, count, (const GLfloat*)data); break;
+			case ShaderDataType::MAT3:		glProgramUniformMatrix3fv(program, location, count, GL_FALSE, (const GLfloat*)data); break;
+			case ShaderDataType::MAT4:		glProgramUniformMatrix4fv(program, location, count, GL_FALSE, (const GLfloat*)data); break;
+			default: RB_CORE_ASSERT(false, "Unsupported uniform type"); break;
+		}
 	}
 
-	void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& matrix)
+	void OpenGLShader::SetInt(const ShaderUniformHandle uniform, const int value)
 	{
 		RB_PROFILE_FUNC();
-		SetUniformMat4(name, matrix);
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, value]() { glProgramUniform1i(id, location, value); });
 	}
 
-	void OpenGLShader::SetUniformInt(const std::string& name, const int value)
+	void OpenGLShader::SetIntArray(const ShaderUniformHandle uniform, const int* values, const uint32 count)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniform1i(loc, value);
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		const int* payload = (const int*)RenderThread::CopyPayload(values, count * sizeof(int));
+		RenderThread::Submit([id = mId, location, payload, count]() { glProgramUniform1iv(id, location, count, payload); });
 	}
 
-	void OpenGLShader::SetUniformIntArray(const std::string& name, const int* values, const uint32 count)
+	void OpenGLShader::SetFloat(const ShaderUniformHandle uniform, const float value)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniform1iv(loc, count, values);
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, value]() { glProgramUniform1f(id, location, value); });
 	}
 
-	void OpenGLShader::SetUniformFloat(const std::string& name, const float value)
+	void OpenGLShader::SetFloat2(const ShaderUniformHandle uniform, const glm::vec2& vec)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniform1f(loc, value);
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, vec]() { glProgramUniform2f(id, location, vec.x, vec.y); });
 	}
 
-	void OpenGLShader::SetUniformVec2(const std::string& name, const glm::vec2& vec)
+	void OpenGLShader::SetFloat3(const ShaderUniformHandle uniform, const glm::vec3& vec)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniform2f(loc, vec.x, vec.y);
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, vec]() { glProgramUniform3f(id, location, vec.x, vec.y, vec.z); });
 	}
 
-	void OpenGLShader::SetUniformVec3(const std::string& name, const glm::vec3& vec)
+	void OpenGLShader::SetFloat4(const ShaderUniformHandle uniform, const glm::vec4& vec)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniform3f(loc, vec.x, vec.y, vec.z);
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, vec]() { glProgramUniform4f(id, location, vec.x, vec.y, vec.z, vec.w); });
 	}
 
-	void OpenGLShader::SetUniformVec4(const std::string& name, const glm::vec4& vec)
+	void OpenGLShader::SetMat3(const ShaderUniformHandle uniform, const glm::mat3& matrix)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniform4f(loc, vec.x, vec.y, vec.z, vec.w);
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, matrix]() { glProgramUniformMatrix3fv(id, location, 1, GL_FALSE, glm::value_ptr(matrix)); });
 	}
 
-	void OpenGLShader::SetUniformMat3(const std::string& name, const glm::mat3& matrix)
+	void OpenGLShader::SetMat4(const ShaderUniformHandle uniform, const glm::mat4& matrix)
 	{
-		int loc = glGetUniformLocation(mId, name.c_str());
-		glUniformMatrix3fv(loc, 1, GL_FALSE, glm::value_ptr(matrix));
+		RB_PROFILE_FUNC();
+		int32 location = GetLocation(uniform);
+		if (location < 0)
+			return;
+
+		RenderThread::Submit([id = mId, location, matrix]() { glProgramUniformMatrix4fv(id, location, 1, GL_FALSE, glm::value_ptr(matrix)); });
 	}
 
-	void OpenGLShader::SetUniformMat4(const std::string& name, const glm::mat4& matrix)
+	void OpenGLShader::SetUniforms(const ShaderUniformValue* values, const uint32 count)
 	{
-		uint32 loc = glGetUniformLocation(mId, name.c_str());
-		glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(matrix));
+		RB_PROFILE_FUNC();
+
+		struct UniformWrite
+		{
+			int32 location;
+			ShaderDataType type;
+			uint32 count;
+			uint32 offset;
+		};
+
+		// Values are packed back to back so the whole update is one command and one payload
+		std::vector<UniformWrite> writes;
+		std::vector<byte> data;
+		writes.reserve(count);
+		for (uint32 i = 0; i < count; i++)
+		{
+			const ShaderUniformValue& value = values[i];
+			int32 location = GetLocation(value.uniform);
+			if (location < 0)
+				continue;
+
+			uint32 size = ShaderDataTypeSize(value.type) * value.count;
+			writes.push_back({ location, value.type, value.count, (uint32)data.size() });
+			data.insert(data.end(), (const byte*)value.data, (const byte*)value.data + size);
+		}
+
+		if (writes.empty())
+			return;
 
+		const UniformWrite* writePayload = (const UniformWrite*)RenderThread::CopyPayload(writes.data(), (uint32)(writes.size() * sizeof(UniformWrite)));
+		const byte* dataPayload = (const byte*)RenderThread::CopyPayload(data.data(), (uint32)data.size());
+		RenderThread::Submit([id = mId, writePayload, dataPayload, writeCount = (uint32)writes.size()]()
+			{
+				for (uint32 i = 0; i < writeCount; i++)
+				{
+					const UniformWrite& write = writePayload[i];
+					UploadUniform(id, write.location, write.type, write.count, dataPayload + write.offset);
+				}
+			});
 	}
 }
-
@@ -24,57 +24,114 @@
 
 #include "rebirth/renderer/Shader.h"
 
+#include <functional>
 
 namespace rebirth
 {
+	struct CookedShader;
+
+	// Constructing compiles the stages in parallel and is safe on any thread, Link creates the GL program.
+	// Shaders in the loaded OpenGLShaderPack are taken from there instead, builds with
+	// RB_NO_SHADER_COMPILER can only create those
 	class OpenGLShader : public Shader
 	{
 	public:
-		OpenGLShader(const std::string& filepath);
+		OpenGLShader(const std::string& filepath, const ShaderDefines& defines = {});
 		OpenGLShader(const std::string& vertexPath, const std::string& pixelPath);
 		OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
 		virtual ~OpenGLShader();
 
+		void Link() override;
+
 		void Bind() const override;
 		void Unbind() const override;
 
 		const std::string& GetName() const override { return mName; }
 
-		void SetInt(const std::string& name, const int value) override;
-		void SetIntArray(const std::string& name, const int* values, const uint32 count);
-		void SetFloat(const std::string& name, const float value) override;
-		void SetFloat2(const std::string& name, const glm::vec2& vec) override;
-		void SetFloat3(const std::string& name, const glm::vec3& vec) override;
-		void SetFloat4(const std::string& name, const glm::vec4& vec) override;
-		void SetMat3(const std::string& name, const glm::mat3& matrix) override;
-		void SetMat4(const std::string& name, const glm::mat4& matrix) override;
-
-		void SetUniformInt(const std::string& name, const int value);
-		void SetUniformIntArray(const std::string& name, const int* values, const uint32 count);
-		void SetUniformFloat(const std::string& name, const float value);
-		void SetUniformVec2(const std::string& name, const glm::vec2& vec);
-		void SetUniformVec3(const std::string& name, const glm::vec3& vec);
-		void SetUniformVec4(const std::string& name, const glm::vec4& vec);
-		void SetUniformMat3(const std::string& name, const glm::mat3& matrix);
-		void SetUniformMat4(const std::string& name, const glm::mat4& matrix);
+		void SetInt(ShaderUniformHandle uniform, const int value) override;
+		void SetIntArray(ShaderUniformHandle uniform, const int* values, const uint32 count) override;
+		void SetFloat(ShaderUniformHandle uniform, const float value) override;
+		void SetFloat2(ShaderUniformHandle uniform, const glm::vec2& vec) override;
+		void SetFloat3(ShaderUniformHandle uniform, const glm::vec3& vec) override;
+		void SetFloat4(ShaderUniformHandle uniform, const glm::vec4& vec) override;
+		void SetMat3(ShaderUniformHandle uniform, const glm::mat3& matrix) override;
+		void SetMat4(ShaderUniformHandle uniform, const glm::mat4& matrix) override;
+
+		using Shader::SetUniforms;
+		void SetUniforms(const ShaderUniformValue* values, uint32 count) override;
+
+		struct UniformInfo
+		{
+			std::string name;
+			int32 location = -1;
+			uint32 count = 1; // array size
+		};
+
+		struct UniformBufferInfo
+		{
+			std::string name;
+			uint32 binding = 0;
+			uint32 size = 0;
+		};
+
+		// Both tables are filled from reflection when the shader is built, nullptr if the shader doesn't have it
+		const UniformInfo* FindUniform(ShaderUniformHandle uniform) const;
+		const UniformBufferInfo* FindUniformBuffer(ShaderUniformHandle block) const;
+
+#ifndef RB_NO_SHADER_COMPILER
+		// Everything a shader pack needs to recreate this shader without compiling it
+		void Cook(CookedShader& outShader) const;
+#endif
 
 	private:
 		std::string Read(const std::string& filepath);
+		void LoadOrCompile(const std::function<std::unordered_map<uint32, std::string>()>& getSources);
+		bool LoadFromPack(uint64 sourceHash);
 		std::unordered_map<uint32, std::string> Preprocess(const std::string& src);
-		void CompileOrGetVulkanBinaries(const std::unordered_map<uint32, std::string>& sources);
-		void CompileOrGetOpenGLBinaries();
+#ifndef RB_NO_SHADER_COMPILER
+		void Compile(const std::unordered_map<uint32, std::string>& sources);
+		void CompileStages(const std::unordered_map<uint32, std::string>& sources);
+		void CompileOrGetVulkanBinary(uint32 stage, const std::string& source);
+		void CompileOrGetOpenGLBinary(uint32 stage);
+		void Reflect(uint32 stage, const std::vector<uint32>& shaderData);
+#endif
+
+		// What cache entries for this shader are recorded under, its path when it came from a file
+		const std::string& GetCacheSource() const;
 
 		void CreateProgram();
-		void Reflect(uint32 stage, const std::vector<uint32>& shaderData);
+		bool CreateProgramFromBinary();
+		void ReflectProgram();
+		void AddUniform(const std::string& name, int32 location, uint32 count);
+		void AddUniformBuffer(const std::string& name, uint32 binding, uint32 size);
+		int32 GetLocation(ShaderUniformHandle uniform) const;
 
 
 		uint32 mId = 0;
 		std::string mName;
 		std::string mFilepath;
 
+		// Passed to the vulkan pass, every cache entry is also stored under the variant name
+		ShaderDefines mDefines;
+		std::string mVariant;
+		uint64 mSourceHash = 0;
+
 		std::unordered_map<uint32, std::vector<uint32>> mVulkanSPIRV;
 		std::unordered_map<uint32, std::vector<uint32>> mOpenGLSPIRV;
 		std::unordered_map<uint32, std::string> mOpenGLsrc;
+
+		// Set when the program cache hit, kept until Link. The sources are only needed if the driver rejects the binary
+		uint64 mProgramKey = 0;
+		uint32 mProgramBinaryFormat = 0;
+		std::vector<byte> mProgramBinary;
+		std::unordered_map<uint32, std::string> mSources;
+
+		// Keyed by ShaderUniformHandle::hash
+		std::unordered_map<uint32, UniformInfo> mUniforms;
+		std::unordered_map<uint32, UniformBufferInfo> mUniformBuffers;
+
+		// Hashes already warned about, so a missing uniform set every frame is only reported once
+		mutable std::unordered_set<uint32> mMissingUniforms;
 	};
 }
 
@@ -0,0 +1,357 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: OpenGLShaderCache.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "OpenGLShaderCache.h"
+
+#include <fstream>
+
+#include <yaml-cpp/yaml.h>
+#include "rebirth/core/Application.h"
+
+namespace rebirth
+{
+	// Bump whenever the way entries are keyed or written changes
+	static constexpr uint32 sCacheVersion = 2;
+
+	struct CacheEntry
+	{
+		std::string source;
+		std::string variant;
+		bool fromFile = false;
+		uint32 stage = 0;
+		std::string target;
+	};
+
+	struct CacheData
+	{
+		bool initialized = false;
+		std::unordered_map<uint64, CacheEntry> entries;
+
+		// source|variant|target|stage -> key of its current entry
+		std::unordered_map<std::string, uint64> slots;
+
+		OpenGLShaderCache::Stats stats;
+		std::mutex mutex;
+	};
+
+	static CacheData sCache;
+
+	static const char* GetCacheDirectory()
+	{
+		return "assets/cache/shader/opengl";
+	}
+
+	static std::filesystem::path GetManifestPath()
+	{
+		return std::filesystem::path(GetCacheDirectory()) / "manifest.yaml";
+	}
+
+	static std::string KeyToString(uint64 key)
+	{
+		return fmt::format("{:016x}", key);
+	}
+
+	static std::filesystem::path GetEntryPath(uint64 key)
+	{
+		return std::filesystem::path(GetCacheDirectory()) / (KeyToString(key) + ".spv");
+	}
+
+	static std::string GetSlot(const CacheEntry& entry)
+	{
+		return fmt::format("{}|{}|{}|{}", entry.source, entry.variant, entry.target, entry.stage);
+	}
+
+	static bool ForceCompileRequested()
+	{
+		// Tools like the shader cook run without an application
+		if (!Application::HasInstance())
+			return false;
+
+		auto args = Application::Instance().GetCommandLineArgs();
+		for (int i = 1; i < args.count; i++)
+		{
+			std::string arg = args[i];
+			if (arg == "-f" || arg == "-F" || arg == "--force-shader-compile")
+				return true;
+		}
+		return false;
+	}
+
+	static void SaveManifest()
+	{
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << YAML::Key << "Version" << YAML::Value << sCacheVersion;
+		out << YAML::Key << "Entries" << YAML::Value << YAML::BeginSeq;
+		for (auto&& [key, entry] : sCache.entries)
+		{
+			out << YAML::BeginMap;
+			out << YAML::Key << "Key" << YAML::Value << KeyToString(key);
+			out << YAML::Key << "Source" << YAML::Value << entry.source;
+			out << YAML::Key << "Variant" << YAML::Value << entry.variant;
+			out << YAML::Key << "File" << YAML::Value << entry.fromFile;
+			out << YAML::Key << "Stage" << YAML::Value << entry.stage;
+			out << YAML::Key << "Target" << YAML::Value << entry.target;
+			out << YAML::EndMap;
+		}
+		out << YAML::EndSeq;
+		out << YAML::EndMap;
+
+		std::ofstream fout(GetManifestPath());
+		fout << out.c_str();
+	}
+
+	// Returns false if there is no manifest or it was written by another cache version
+	static bool LoadManifest()
+	{
+		std::ifstream stream(GetManifestPath());
+		if (!stream)
+			return false;
+
+		std::stringstream strStream;
+		strStream << stream.rdbuf();
+
+		// Missing or mistyped fields throw from as<> just like bad syntax, either way the cache starts empty
+		try {
+			YAML::Node data = YAML::Load(strStream.str());
+			if (!data["Version"] || data["Version"].as<uint32>() != sCacheVersion)
+				return false;
+
+			for (auto node : data["Entries"])
+			{
+				uint64 key = std::strtoull(node["Key"].as<std::string>().c_str(), nullptr, 16);
+				CacheEntry entry;
+				entry.source = node["Source"].as<std::string>();
+				entry.variant = node["Variant"].as<std::string>();
+				entry.fromFile = node["File"].as<bool>();
+				entry.stage = node["Stage"].as<uint32>();
+				entry.target = node["Target"].as<std::string>();
+
+				sCache.slots[GetSlot(entry)] = key;
+				sCache.entries[key] = std::move(entry);
+			}
+		}
+		catch (YAML::Exception e)
+		{
+			RB_CORE_WARN("Shader cache manifest is corrupt, discarding the cache");
+			return false;
+		}
+		return true;
+	}
+
+	static void CollectGarbage()
+	{
+		RB_PROFILE_FUNC();
+
+		// Entries whose binary went missing or whose shader file was deleted
+		for (auto it = sCache.entries.begin(); it != sCache.entries.end();)
+		{
+			const CacheEntry& entry = it->second;
+			if (!std::filesystem::exists(GetEntryPath(it->first)) || (entry.fromFile && !std::filesystem::exists(entry.source)))
+			{
+				sCache.slots.erase(GetSlot(entry));
+				it = sCache.entries.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		// Anything the manifest doesn't reference, including binaries from older cache layouts
+		std::error_code error;
+		for (auto& file : std::filesystem::directory_iterator(GetCacheDirectory()))
+		{
+			const auto& path = file.path();
+			if (path == GetManifestPath())
+				continue;
+
+			bool referenced = false;
+			if (path.extension() == ".spv")
+			{
+				std::string name = path.stem().string();
+				char* end = nullptr;
+				uint64 key = std::strtoull(name.c_str(), &end, 16);
+				referenced = *end == '\0' && sCache.entries.count(key);
+			}
+
+			if (!referenced)
+			{
+				std::filesystem::remove_all(path, error);
+				sCache.stats.evicted++;
+			}
+		}
+
+		SaveManifest();
+	}
+
+	void ShaderHasher::Add(const void* data, const size_t size)
+	{
+		const byte* bytes = (const byte*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			mHash ^= bytes[i];
+			mHash *= 1099511628211ull;
+		}
+	}
+
+	static void InitLocked()
+	{
+		if (sCache.initialized)
+			return;
+		sCache.initialized = true;
+
+		RB_PROFILE_FUNC();
+
+		std::string cacheDir = GetCacheDirectory();
+		if (ForceCompileRequested())
+		{
+			RB_CORE_TRACE("force-shader-compile command line argument detected, deleting cached shaders and recompiling");
+			std::filesystem::remove_all(cacheDir);
+		}
+
+		if (!std::filesystem::exists(cacheDir))
+			std::filesystem::create_directories(cacheDir);
+
+		if (!LoadManifest())
+		{
+			sCache.entries.clear();
+			sCache.slots.clear();
+		}
+
+		CollectGarbage();
+		RB_CORE_INFO("Shader cache holds {} entries, deleted {} stale files", sCache.entries.size(), sCache.stats.evicted);
+	}
+
+	static bool ReadEntry(const uint64 key, std::vector<byte>& outData)
+	{
+		if (sCache.entries.find(key) != sCache.entries.end())
+		{
+			std::ifstream in(GetEntryPath(key), std::ios::in | std::ios::binary);
+			if (in.is_open())
+			{
+				in.seekg(0, std::ios::end);
+				auto size = in.tellg();
+				in.seekg(0, std::ios::beg);
+
+				outData.resize(size);
+				in.read((char*)outData.data(), size);
+				sCache.stats.hits++;
+				return true;
+			}
+		}
+
+		sCache.stats.misses++;
+		return false;
+	}
+
+	static void WriteEntry(const uint64 key, CacheEntry entry, const void* data, const size_t size)
+	{
+		std::ofstream out(GetEntryPath(key), std::ios::out | std::ios::binary);
+		if (!out.is_open())
+		{
+			RB_CORE_WARN("Failed to write shader cache entry for {}", entry.source);
+			return;
+		}
+		out.write((const char*)data, size);
+		out.close();
+
+		// The previous binary for this slot can never be hit again
+		uint64& slot = sCache.slots[GetSlot(entry)];
+		if (slot && slot != key)
+		{
+			std::error_code error;
+			std::filesystem::remove(GetEntryPath(slot), error);
+			sCache.entries.erase(slot);
+			sCache.stats.evicted++;
+		}
+		slot = key;
+		sCache.entries[key] = std::move(entry);
+
+		SaveManifest();
+	}
+
+	void OpenGLShaderCache::Init()
+	{
+		std::lock_guard lock(sCache.mutex);
+		InitLocked();
+	}
+
+	bool OpenGLShaderCache::Load(const uint64 key, std::vector<uint32>& outSpirv)
+	{
+		std::lock_guard lock(sCache.mutex);
+		InitLocked();
+
+		std::vector<byte> data;
+		if (!ReadEntry(key, data))
+			return false;
+
+		outSpirv.resize(data.size() / sizeof(uint32));
+		std::memcpy(outSpirv.data(), data.data(), outSpirv.size() * sizeof(uint32));
+		return true;
+	}
+
+	void OpenGLShaderCache::Store(const uint64 key, const std::string& source, const std::string& variant, const bool fromFile, const uint32 stage, const char* target, const std::vector<uint32>& spirv)
+	{
+		std::lock_guard lock(sCache.mutex);
+		InitLocked();
+		WriteEntry(key, { source, variant, fromFile, stage, target }, spirv.data(), spirv.size() * sizeof(uint32));
+	}
+
+	// Program entries start with the binary format the driver reported
+	bool OpenGLShaderCache::LoadProgram(const uint64 key, uint32& outFormat, std::vector<byte>& outBinary)
+	{
+		std::lock_guard lock(sCache.mutex);
+		InitLocked();
+
+		if (!ReadEntry(key, outBinary))
+			return false;
+
+		if (outBinary.size() < sizeof(uint32))
+		{
+			outBinary.clear();
+			return false;
+		}
+
+		std::memcpy(&outFormat, outBinary.data(), sizeof(uint32));
+		outBinary.erase(outBinary.begin(), outBinary.begin() + sizeof(uint32));
+		return true;
+	}
+
+	void OpenGLShaderCache::StoreProgram(const uint64 key, const std::string& source, const std::string& variant, const bool fromFile, const uint32 format, const std::vector<byte>& binary)
+	{
+		std::lock_guard lock(sCache.mutex);
+		InitLocked();
+
+		std::vector<byte> data(sizeof(uint32) + binary.size());
+		std::memcpy(data.data(), &format, sizeof(uint32));
+		std::memcpy(data.data() + sizeof(uint32), binary.data(), binary.size());
+		WriteEntry(key, { source, variant, fromFile, 0, "program" }, data.data(), data.size());
+	}
+
+	OpenGLShaderCache::Stats OpenGLShaderCache::GetStats()
+	{
+		std::lock_guard lock(sCache.mutex);
+		return sCache.stats;
+	}
+}
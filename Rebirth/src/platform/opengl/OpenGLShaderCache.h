@@ -0,0 +1,78 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: OpenGLShaderCache.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+namespace rebirth
+{
+	// FNV-1a, feeds everything that changes a compiled stage into one cache key
+	class ShaderHasher
+	{
+	public:
+		void Add(const void* data, size_t size);
+		void Add(const std::string& str) { Add(str.data(), str.size()); }
+
+		template<typename T>
+		void Add(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be hashed as raw bytes");
+			Add(&value, sizeof(T));
+		}
+
+		uint64 Get() const { return mHash; }
+
+	private:
+		uint64 mHash = 14695981039346656037ull;
+	};
+
+	// SPIR-V cache in assets/cache/shader/opengl. Each stage is stored as <key>.spv, where the key
+	// hashes the source name, stage, compile options, compiler versions and the preprocessed source,
+	// so editing a shader or updating the SDK misses instead of loading a stale binary.
+	// Linked programs from glGetProgramBinary are stored the same way under the "program" target.
+	// manifest.yaml keeps the current key per source, variant and stage. An entry is deleted once a new one
+	// replaces it, and files the manifest doesn't know about are deleted on startup. Thread safe
+	class OpenGLShaderCache
+	{
+	public:
+		struct Stats
+		{
+			uint32 hits = 0;
+			uint32 misses = 0;
+			uint32 evicted = 0; // replaced or orphaned entries that were deleted
+		};
+
+		// Loads the manifest and collects garbage, only the first call does anything.
+		// -f/--force-shader-compile on the command line empties the cache instead
+		static void Init();
+
+		static bool Load(uint64 key, std::vector<uint32>& outSpirv);
+
+		// fromFile marks source as a path, its entries are dropped once that file is gone.
+		// variant is the define set the source was compiled with, so variants don't replace each other
+		static void Store(uint64 key, const std::string& source, const std::string& variant, bool fromFile, uint32 stage, const char* target, const std::vector<uint32>& spirv);
+
+		static bool LoadProgram(uint64 key, uint32& outFormat, std::vector<byte>& outBinary);
+		static void StoreProgram(uint64 key, const std::string& source, const std::string& variant, bool fromFile, uint32 format, const std::vector<byte>& binary);
+
+		static Stats GetStats();
+	};
+}
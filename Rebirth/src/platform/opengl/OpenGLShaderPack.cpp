@@ -0,0 +1,437 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: OpenGLShaderPack.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "OpenGLShaderPack.h"
+
+#include <fstream>
+#include <deque>
+#include "rebirth/core/Pack.h"
+#include "rebirth/core/JobSystem.h"
+#include "rebirth/util/PlatformUtil.h"
+
+namespace rebirth
+{
+	// "RBSP"
+	static constexpr uint32 sPackMagic = 0x50534252;
+
+	struct PackString
+	{
+		uint32 offset;
+		uint32 size;
+	};
+
+	struct PackHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 shaderCount;
+		uint32 stageCount;
+		uint32 uniformCount;
+		uint32 bufferCount;
+	};
+
+	struct PackShader
+	{
+		PackString name;
+		uint64 sourceHash;
+		uint32 firstStage;
+		uint32 stageCount;
+		uint32 firstUniform;
+		uint32 uniformCount;
+		uint32 firstBuffer;
+		uint32 bufferCount;
+	};
+
+	struct PackStage
+	{
+		uint32 stage;
+		uint32 spirvOffset;
+		uint32 spirvWords;
+		PackString glsl;
+	};
+
+	struct PackUniform
+	{
+		PackString name;
+		int32 location;
+		uint32 count;
+	};
+
+	struct PackBuffer
+	{
+		PackString name;
+		uint32 binding;
+		uint32 size;
+	};
+
+	// The tables are read straight out of the mapping, so every record has to keep the next one aligned
+	static_assert(sizeof(PackHeader) % 8 == 0 && sizeof(PackShader) % 8 == 0, "Pack records must stay 8 byte aligned");
+	static_assert(sizeof(PackStage) % 4 == 0 && sizeof(PackUniform) % 4 == 0 && sizeof(PackBuffer) % 4 == 0, "Pack records must stay 4 byte aligned");
+
+	struct PackData
+	{
+		// Mapped from disk, or a view of the asset pack entry
+		MappedFile file;
+		PackView view;
+		const byte* data = nullptr;
+		uint64 size = 0;
+		const PackShader* shaders = nullptr;
+		const PackStage* stages = nullptr;
+		const PackUniform* uniforms = nullptr;
+		const PackBuffer* buffers = nullptr;
+		std::unordered_map<std::string_view, const PackShader*> lookup;
+	};
+
+	static PackData sPack;
+
+	static bool InFile(const uint64 offset, const uint64 size)
+	{
+		return offset <= sPack.size && size <= sPack.size - offset;
+	}
+
+	static std::string_view GetString(const PackString& str)
+	{
+		return std::string_view((const char*)sPack.data + str.offset, str.size);
+	}
+
+	// Checks every range up front so Find never has to
+	static bool Validate(const PackHeader& header)
+	{
+		for (uint32 i = 0; i < header.shaderCount; i++)
+		{
+			const PackShader& shader = sPack.shaders[i];
+			if (!InFile(shader.name.offset, shader.name.size)
+				|| (uint64)shader.firstStage + shader.stageCount > header.stageCount
+				|| (uint64)shader.firstUniform + shader.uniformCount > header.uniformCount
+				|| (uint64)shader.firstBuffer + shader.bufferCount > header.bufferCount)
+				return false;
+		}
+
+		for (uint32 i = 0; i < header.stageCount; i++)
+		{
+			const PackStage& stage = sPack.stages[i];
+			if (stage.spirvOffset % sizeof(uint32) || !InFile(stage.spirvOffset, (uint64)stage.spirvWords * sizeof(uint32)) || !InFile(stage.glsl.offset, stage.glsl.size))
+				return false;
+		}
+
+		for (uint32 i = 0; i < header.uniformCount; i++)
+		{
+			if (!InFile(sPack.uniforms[i].name.offset, sPack.uniforms[i].name.size))
+				return false;
+		}
+
+		for (uint32 i = 0; i < header.bufferCount; i++)
+		{
+			if (!InFile(sPack.buffers[i].name.offset, sPack.buffers[i].name.size))
+				return false;
+		}
+		return true;
+	}
+
+	bool OpenGLShaderPack::Load(const std::string& filepath)
+	{
+		RB_PROFILE_FUNC();
+		Unload();
+
+		if (Pack::Read(filepath, sPack.view))
+		{
+			sPack.data = sPack.view.GetData();
+			sPack.size = sPack.view.GetSize();
+		}
+		else if (sPack.file.Open(filepath))
+		{
+			sPack.data = sPack.file.GetData();
+			sPack.size = sPack.file.GetSize();
+		}
+		else
+		{
+			return false;
+		}
+
+		if (sPack.size < sizeof(PackHeader))
+		{
+			RB_CORE_WARN("Shader pack {} is truncated", filepath);
+			Unload();
+			return false;
+		}
+
+		const PackHeader& header = *(const PackHeader*)sPack.data;
+		if (header.magic != sPackMagic || header.version != VERSION)
+		{
+			RB_CORE_WARN("Shader pack {} was cooked by another version, ignoring it", filepath);
+			Unload();
+			return false;
+		}
+
+		uint64 offset = sizeof(PackHeader);
+		uint64 tableSize = (uint64)header.shaderCount * sizeof(PackShader) + (uint64)header.stageCount * sizeof(PackStage)
+			+ (uint64)header.uniformCount * sizeof(PackUniform) + (uint64)header.bufferCount * sizeof(PackBuffer);
+		if (!InFile(offset, tableSize))
+		{
+			RB_CORE_WARN("Shader pack {} is truncated", filepath);
+			Unload();
+			return false;
+		}
+
+		const byte* data = sPack.data;
+		sPack.shaders = (const PackShader*)(data + offset);
+		offset += (uint64)header.shaderCount * sizeof(PackShader);
+		sPack.stages = (const PackStage*)(data + offset);
+		offset += (uint64)header.stageCount * sizeof(PackStage);
+		sPack.uniforms = (const PackUniform*)(data + offset);
+		offset += (uint64)header.uniformCount * sizeof(PackUniform);
+		sPack.buffers = (const PackBuffer*)(data + offset);
+
+		if (!Validate(header))
+		{
+			RB_CORE_WARN("Shader pack {} is corrupt", filepath);
+			Unload();
+			return false;
+		}
+
+		for (uint32 i = 0; i < header.shaderCount; i++)
+			sPack.lookup[GetString(sPack.shaders[i].name)] = &sPack.shaders[i];
+
+		RB_CORE_INFO("Loaded shader pack {} with {} shaders", filepath, header.shaderCount);
+		return true;
+	}
+
+	void OpenGLShaderPack::Unload()
+	{
+		sPack.lookup.clear();
+		sPack.shaders = nullptr;
+		sPack.stages = nullptr;
+		sPack.uniforms = nullptr;
+		sPack.buffers = nullptr;
+		sPack.file.Close();
+		sPack.view = PackView();
+		sPack.data = nullptr;
+		sPack.size = 0;
+	}
+
+	bool OpenGLShaderPack::IsLoaded()
+	{
+		return sPack.data != nullptr;
+	}
+
+	bool OpenGLShaderPack::Find(const std::string& name, CookedShader& outShader)
+	{
+		auto it = sPack.lookup.find(name);
+		if (it == sPack.lookup.end())
+			return false;
+
+		const PackShader& shader = *it->second;
+		outShader.name = name;
+		outShader.sourceHash = shader.sourceHash;
+
+		outShader.stages.resize(shader.stageCount);
+		for (uint32 i = 0; i < shader.stageCount; i++)
+		{
+			const PackStage& stage = sPack.stages[shader.firstStage + i];
+			const uint32* spirv = (const uint32*)(sPack.data + stage.spirvOffset);
+			outShader.stages[i].stage = stage.stage;
+			outShader.stages[i].spirv.assign(spirv, spirv + stage.spirvWords);
+			outShader.stages[i].glsl = GetString(stage.glsl);
+		}
+
+		outShader.uniforms.resize(shader.uniformCount);
+		for (uint32 i = 0; i < shader.uniformCount; i++)
+		{
+			const PackUniform& uniform = sPack.uniforms[shader.firstUniform + i];
+			outShader.uniforms[i] = { std::string(GetString(uniform.name)), uniform.location, uniform.count };
+		}
+
+		outShader.uniformBuffers.resize(shader.bufferCount);
+		for (uint32 i = 0; i < shader.bufferCount; i++)
+		{
+			const PackBuffer& buffer = sPack.buffers[shader.firstBuffer + i];
+			outShader.uniformBuffers[i] = { std::string(GetString(buffer.name)), buffer.binding, buffer.size };
+		}
+		return true;
+	}
+
+	bool OpenGLShaderPack::Write(const std::string& filepath, const std::vector<CookedShader>& shaders)
+	{
+		RB_PROFILE_FUNC();
+
+		PackHeader header = { sPackMagic, VERSION, (uint32)shaders.size(), 0, 0, 0 };
+		for (const auto& shader : shaders)
+		{
+			header.stageCount += (uint32)shader.stages.size();
+			header.uniformCount += (uint32)shader.uniforms.size();
+			header.bufferCount += (uint32)shader.uniformBuffers.size();
+		}
+
+		std::vector<PackShader> packShaders;
+		std::vector<PackStage> packStages;
+		std::vector<PackUniform> packUniforms;
+		std::vector<PackBuffer> packBuffers;
+
+		// Strings and SPIR-V go after the tables, SPIR-V words stay 4 byte aligned
+		std::vector<byte> blob;
+		const uint64 blobOffset = sizeof(PackHeader) + (uint64)header.shaderCount * sizeof(PackShader) + (uint64)header.stageCount * sizeof(PackStage)
+			+ (uint64)header.uniformCount * sizeof(PackUniform) + (uint64)header.bufferCount * sizeof(PackBuffer);
+
+		auto addData = [&](const void* data, const size_t size)
+		{
+			while ((blobOffset + blob.size()) % sizeof(uint32))
+				blob.push_back(0);
+
+			uint32 offset = (uint32)(blobOffset + blob.size());
+			blob.insert(blob.end(), (const byte*)data, (const byte*)data + size);
+			return offset;
+		};
+
+		auto addString = [&](const std::string& str)
+		{
+			return PackString{ addData(str.data(), str.size()), (uint32)str.size() };
+		};
+
+		for (const auto& shader : shaders)
+		{
+			PackShader& packShader = packShaders.emplace_back();
+			packShader.name = addString(shader.name);
+			packShader.sourceHash = shader.sourceHash;
+			packShader.firstStage = (uint32)packStages.size();
+			packShader.stageCount = (uint32)shader.stages.size();
+			packShader.firstUniform = (uint32)packUniforms.size();
+			packShader.uniformCount = (uint32)shader.uniforms.size();
+			packShader.firstBuffer = (uint32)packBuffers.size();
+			packShader.bufferCount = (uint32)shader.uniformBuffers.size();
+
+			for (const auto& stage : shader.stages)
+			{
+				uint32 spirvOffset = addData(stage.spirv.data(), stage.spirv.size() * sizeof(uint32));
+				packStages.push_back({ stage.stage, spirvOffset, (uint32)stage.spirv.size(), addString(stage.glsl) });
+			}
+
+			for (const auto& uniform : shader.uniforms)
+				packUniforms.push_back({ addString(uniform.name), uniform.location, uniform.count });
+
+			for (const auto& buffer : shader.uniformBuffers)
+				packBuffers.push_back({ addString(buffer.name), buffer.binding, buffer.size });
+		}
+
+		if (blobOffset + blob.size() > std::numeric_limits<uint32>::max())
+		{
+			RB_CORE_ERROR("Shader pack {} would be over 4GB", filepath);
+			return false;
+		}
+
+		std::ofstream out(filepath, std::ios::out | std::ios::binary);
+		if (!out.is_open())
+		{
+			RB_CORE_ERROR("Failed to open shader pack {} for writing", filepath);
+			return false;
+		}
+
+		out.write((const char*)&header, sizeof(PackHeader));
+		out.write((const char*)packShaders.data(), packShaders.size() * sizeof(PackShader));
+		out.write((const char*)packStages.data(), packStages.size() * sizeof(PackStage));
+		out.write((const char*)packUniforms.data(), packUniforms.size() * sizeof(PackUniform));
+		out.write((const char*)packBuffers.data(), packBuffers.size() * sizeof(PackBuffer));
+		out.write((const char*)blob.data(), blob.size());
+		return out.good();
+	}
+
+#ifndef RB_NO_SHADER_COMPILER
+	bool OpenGLShaderPack::Cook(const std::vector<std::string>& files, const std::string& filepath)
+	{
+		RB_PROFILE_FUNC();
+
+		// Sorted so the same shaders always give the same pack
+		std::vector<std::string> sorted = files;
+		std::sort(sorted.begin(), sorted.end());
+
+		// Each shader already compiles its stages in parallel, this runs the shaders side by side as well
+		// A deque so each job's slot stays put while more are added
+		std::deque<CookedShader> cookedShaders;
+		JobCounter jobs;
+		for (const auto& file : sorted)
+		{
+			auto extension = std::filesystem::path(file).extension();
+			if (extension == ".glsl")
+			{
+				for (const auto& defines : Shader::ReadVariants(file))
+				{
+					CookedShader* cooked = &cookedShaders.emplace_back();
+					JobSystem::Execute("OpenGLShaderPack::Cook", [file, defines, cooked]()
+						{
+							OpenGLShader(file, defines).Cook(*cooked);
+						}, &jobs);
+				}
+			}
+			else if (extension == ".vert")
+			{
+				auto pixelPath = std::filesystem::path(file).replace_extension(".frag");
+				if (!std::filesystem::exists(pixelPath))
+				{
+					RB_CORE_WARN("{} has no matching .frag, skipping it", file);
+					continue;
+				}
+
+				CookedShader* cooked = &cookedShaders.emplace_back();
+				JobSystem::Execute("OpenGLShaderPack::Cook", [vertexPath = file, pixelPath = pixelPath.string(), cooked]()
+					{
+						OpenGLShader(vertexPath, pixelPath).Cook(*cooked);
+					}, &jobs);
+			}
+		}
+
+		JobSystem::Wait(jobs);
+
+		std::vector<CookedShader> shaders;
+		std::unordered_set<std::string> names;
+		bool failed = false;
+		for (auto& cooked : cookedShaders)
+		{
+
+			bool empty = cooked.stages.empty();
+			for (const auto& stage : cooked.stages)
+				empty |= stage.spirv.empty();
+
+			if (empty)
+			{
+				RB_CORE_ERROR("Failed to cook {}", cooked.name);
+				failed = true;
+				continue;
+			}
+
+			if (!names.insert(cooked.name).second)
+			{
+				RB_CORE_ERROR("More than one shader is named {}", cooked.name);
+				failed = true;
+				continue;
+			}
+
+			RB_CORE_INFO("Cooked {}: {} stages, {} uniforms, {} uniform buffers", cooked.name, cooked.stages.size(), cooked.uniforms.size(), cooked.uniformBuffers.size());
+			shaders.push_back(std::move(cooked));
+		}
+
+		if (failed)
+			return false;
+
+		return Write(filepath, shaders);
+	}
+#endif
+}
@@ -0,0 +1,73 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: OpenGLShaderPack.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "OpenGLShader.h"
+
+namespace rebirth
+{
+	// Everything needed to create a shader without compiling it
+	struct CookedShader
+	{
+		struct Stage
+		{
+			uint32 stage = 0;
+			std::vector<uint32> spirv; // opengl target, what gets linked
+			std::string glsl; // cross compiled from the vulkan binary, for tools and debugging
+		};
+
+		std::string name; // includes the variant, same as OpenGLShader::GetName
+		uint64 sourceHash = 0;
+		std::vector<Stage> stages;
+		std::vector<OpenGLShader::UniformInfo> uniforms;
+		std::vector<OpenGLShader::UniformBufferInfo> uniformBuffers;
+	};
+
+	// Shaders cooked ahead of time by Rebirth-ShaderCook, in one file that is mapped once at startup.
+	// Layout: header, then the shader, stage, uniform and uniform buffer tables, then the strings and
+	// SPIR-V the tables point into. Offsets are from the start of the file
+	class OpenGLShaderPack
+	{
+	public:
+		static constexpr const char* DEFAULT_PATH = "assets/shaders.rbpack";
+		// Bump whenever a record changes, Rebirth-Cook recooks the pack then
+		static constexpr uint32 VERSION = 1;
+
+		// Replaces the loaded pack. False if the file is missing or isn't a pack of this version
+		static bool Load(const std::string& filepath);
+		static void Unload();
+		static bool IsLoaded();
+
+		// Copies the shader out of the pack, false if the pack doesn't have it
+		static bool Find(const std::string& name, CookedShader& outShader);
+
+		static bool Write(const std::string& filepath, const std::vector<CookedShader>& shaders);
+
+#ifndef RB_NO_SHADER_COMPILER
+		// Cooks the shader files side by side and writes them as one pack. Every .glsl file is cooked once
+		// per variant, see Shader::ReadVariants, and a .vert with a .frag of the same name as one shader.
+		// Other files are ignored. False if any shader fails, nothing is written then
+		static bool Cook(const std::vector<std::string>& files, const std::string& filepath);
+#endif
+	};
+}
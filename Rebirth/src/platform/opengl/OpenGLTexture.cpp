@@ -23,25 +23,61 @@
 
 #include "rbpch.h"
 #include "OpenGLTexture.h"
+#include "rebirth/renderer/RenderThread.h"
+#include "rebirth/renderer/CookedTexture.h"
+#include "rebirth/renderer/ImageLoader.h"
+#include "rebirth/renderer/GraphicsAPI.h"
+#include "rebirth/core/Assets.h"
 
 #include <stb_image.h>
 
 #include <glad/glad.h>
 
+// From EXT_texture_compression_s3tc, the core profile loader leaves them out
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#	define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#	define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace rebirth
 {
+	// Staging buffer shared by every streamed upload, orphaned before each chunk
+	static uint32 sUploadBuffer = 0;
 
-	OpenGLTexture2D::OpenGLTexture2D(const std::string& path) :
-		mPath(path)
+	static void SetFormat(uint32 channels, uint32& outInternalFormat, uint32& outDataFormat)
+	{
+		if (channels == 4)
+		{
+			outInternalFormat = GL_RGBA8;
+			outDataFormat = GL_RGBA;
+		}
+		else if (channels == 3)
+		{
+			outInternalFormat = GL_RGB8;
+			outDataFormat = GL_RGB;
+		}
+	}
+
+	OpenGLTexture2D::OpenGLTexture2D(const std::string& path, const bool async) :
+		mWidth(0), mHeight(0), mInternalFormat(0), mDataFormat(0), mPending(async), mPath(path)
 	{
 		RB_PROFILE_FUNC();
+		if (async)
+		{
+			RB_CORE_TRACE("Queued texture {} for streaming", path);
+			return;
+		}
+
+		if (LoadCooked(CookedTexture::FindCooked(path)))
+			return;
+
 		RB_CORE_TRACE("Loading texture from file {}", path);
 		int width, height, channels;
 		stbi_set_flip_vertically_on_load(1);
 		byte* data = nullptr;
 		{
-			RB_PROFILE_SCOPE("stbi_load in OpenGLTexture2D::OpenGLTexture2D(const std::string&)");
-			data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+			RB_PROFILE_SCOPE("ImageLoader::Load in OpenGLTexture2D::OpenGLTexture2D(const std::string&)");
+			data = ImageLoader::Load(path, width, height, channels);
 		}
 
 		// #NOTE perhaps default texture ? -Or perhaps better is to make default texture be when creating a quad/sprite/model/etc
@@ -52,30 +88,24 @@ namespace rebirth
 			mWidth = width;
 			mHeight = height;
 
-			if (channels == 4)
-			{
-				mInternalFormat = GL_RGBA8;
-				mDataFormat = GL_RGBA;
-			}
-			else if (channels == 3)
-			{
-				mInternalFormat = GL_RGB8;
-				mDataFormat = GL_RGB;
-			}
-
+			SetFormat(channels, mInternalFormat, mDataFormat);
 			RB_CORE_ASSERT(mInternalFormat & mDataFormat, "Image format not supported");
+			mMemorySize = (uint64)width * height * channels;
 
-			glCreateTextures(GL_TEXTURE_2D, 1, &mId);
-			glTextureStorage2D(mId, 1, mInternalFormat, mWidth, mHeight);
+			RenderThread::Invoke([this, data]()
+				{
+					glCreateTextures(GL_TEXTURE_2D, 1, &mId);
+					glTextureStorage2D(mId, 1, mInternalFormat, mWidth, mHeight);
 
-			glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			glTextureParameteri(mId, GL_TEXTURE_WRAP_S, GL_REPEAT);
-			glTextureParameteri(mId, GL_TEXTURE_WRAP_T, GL_REPEAT);
+					glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+					glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+					glTextureParameteri(mId, GL_TEXTURE_WRAP_S, GL_REPEAT);
+					glTextureParameteri(mId, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-			glTextureSubImage2D(mId, 0, 0, 0, mWidth, mHeight, mDataFormat, GL_UNSIGNED_BYTE, data);
+					glTextureSubImage2D(mId, 0, 0, 0, mWidth, mHeight, mDataFormat, GL_UNSIGNED_BYTE, data);
+				});
 
-			stbi_image_free(data);
+			ImageLoader::Free(data);
 
 			mLoaded = true;
 			RB_CORE_TRACE("Texture {} loaded", path);
@@ -89,33 +119,194 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		mInternalFormat = GL_RGBA8;
 		mDataFormat = GL_RGBA;
+		mMemorySize = (uint64)width * height * 4;
 
-		glCreateTextures(GL_TEXTURE_2D, 1, &mId);
-		glTextureStorage2D(mId, 1, mInternalFormat, mWidth, mHeight);
+		RenderThread::Invoke([this]()
+			{
+				glCreateTextures(GL_TEXTURE_2D, 1, &mId);
+				glTextureStorage2D(mId, 1, mInternalFormat, mWidth, mHeight);
 
-		glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTextureParameteri(mId, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTextureParameteri(mId, GL_TEXTURE_WRAP_T, GL_REPEAT);
+				glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				glTextureParameteri(mId, GL_TEXTURE_WRAP_S, GL_REPEAT);
+				glTextureParameteri(mId, GL_TEXTURE_WRAP_T, GL_REPEAT);
+			});
 	}
 
 	OpenGLTexture2D::~OpenGLTexture2D()
 	{
 		RB_PROFILE_FUNC();
-		glDeleteTextures(1, &mId);
+		RenderThread::Submit([id = mId]() { glDeleteTextures(1, &id); });
 	}
 
 	void OpenGLTexture2D::Bind(const uint32 slot /*= 0*/) const
 	{
 		RB_PROFILE_FUNC();
-		glBindTextureUnit(slot, mId);
+		if (mPending)
+		{
+			Assets::GetDefaultTexture()->Bind(slot);
+			return;
+		}
+
+		RenderThread::Submit([id = mId, slot]() { glBindTextureUnit(slot, id); });
 	}
 
 	void OpenGLTexture2D::SetData(void* data, uint32 size)
 	{
 		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!mCompressed, "Compressed textures can't be written to");
 		RB_CORE_ASSERT(size == mWidth * mHeight * (mDataFormat == GL_RGBA ? 4 : 3), "Data must contain entire texture");
-		glTextureSubImage2D(mId, 0, 0, 0, mWidth, mHeight, mDataFormat, GL_UNSIGNED_BYTE, data);
+		const void* payload = RenderThread::CopyPayload(data, size);
+		RenderThread::Submit([id = mId, width = mWidth, height = mHeight, format = mDataFormat, payload]()
+			{
+				glTextureSubImage2D(id, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, payload);
+			});
+	}
+
+	void OpenGLTexture2D::SetSubData(const void* data, uint32 x, uint32 y, uint32 width, uint32 height)
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!mCompressed, "Compressed textures can't be written to");
+		RB_CORE_ASSERT(x + width <= (uint32)mWidth && y + height <= (uint32)mHeight, "Sub data is out of the texture's bounds");
+		const void* payload = RenderThread::CopyPayload(data, width * height * 4);
+		RenderThread::Submit([id = mId, x, y, width, height, payload]()
+			{
+				glTextureSubImage2D(id, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, payload);
+			});
+	}
+
+	bool OpenGLTexture2D::ReadPixels(std::vector<byte>& outData) const
+	{
+		RB_PROFILE_FUNC();
+		if (!mId || mPending)
+			return false;
+
+		uint32 size = mWidth * mHeight * 4;
+		outData.resize(size);
+		RenderThread::Invoke([this, size, &outData]() { glGetTextureImage(mId, 0, GL_RGBA, GL_UNSIGNED_BYTE, size, outData.data()); });
+		return true;
+	}
+
+	uint32 OpenGLTexture2D::GetId() const
+	{
+		return mPending ? Assets::GetDefaultTexture()->GetId() : mId;
+	}
+
+	uint64 OpenGLTexture2D::GetMemorySize() const
+	{
+		return mPending ? 0 : mMemorySize;
+	}
+
+	bool OpenGLTexture2D::LoadCooked(const std::string& cookedPath)
+	{
+		if (cookedPath.empty())
+			return false;
+
+		RB_PROFILE_FUNC();
+		CookedTexture cooked;
+		if (!cooked.Open(cookedPath))
+			return false;
+
+		switch (cooked.GetFormat())
+		{
+			case CookedTextureFormat::RGBA8:
+				mInternalFormat = GL_RGBA8;
+				mDataFormat = GL_RGBA;
+				break;
+			case CookedTextureFormat::BC1:
+				mInternalFormat = mDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+				mCompressed = true;
+				break;
+			case CookedTextureFormat::BC3:
+				mInternalFormat = mDataFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+				mCompressed = true;
+				break;
+		}
+
+		if (mCompressed && !GraphicsAPI::GetCapabilities().textureCompression)
+		{
+			RB_CORE_WARN("Compressed textures aren't supported here, loading {} from its source", mPath);
+			mCompressed = false;
+			return false;
+		}
+
+		mWidth = (int)cooked.GetWidth();
+		mHeight = (int)cooked.GetHeight();
+
+		// Invoke waits, so the levels are read straight out of the mapping
+		const auto& levels = cooked.GetLevels();
+		RenderThread::Invoke([this, &levels]()
+			{
+				glCreateTextures(GL_TEXTURE_2D, 1, &mId);
+				glTextureStorage2D(mId, (GLsizei)levels.size(), mInternalFormat, mWidth, mHeight);
+
+				glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, levels.size() > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+				glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				glTextureParameteri(mId, GL_TEXTURE_WRAP_S, GL_REPEAT);
+				glTextureParameteri(mId, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+				for (GLint i = 0; i < (GLint)levels.size(); i++)
+				{
+					const auto& level = levels[i];
+					if (mCompressed)
+						glCompressedTextureSubImage2D(mId, i, 0, 0, level.width, level.height, mInternalFormat, level.size, level.data);
+					else
+						glTextureSubImage2D(mId, i, 0, 0, level.width, level.height, GL_RGBA, GL_UNSIGNED_BYTE, level.data);
+				}
+			});
+
+		mMemorySize = cooked.GetDataSize();
+		mMipLevels = (uint32)levels.size();
+		mLoaded = true;
+		RB_CORE_TRACE("Texture {} loaded from {}", mPath, cookedPath);
+		return true;
+	}
+
+	void OpenGLTexture2D::BeginUpload(const uint32 width, const uint32 height, const uint32 channels)
+	{
+		RB_PROFILE_FUNC();
+		mWidth = (int)width;
+		mHeight = (int)height;
+		SetFormat(channels, mInternalFormat, mDataFormat);
+		RB_CORE_ASSERT(mInternalFormat & mDataFormat, "Image format not supported");
+		mMemorySize = (uint64)width * height * channels;
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &mId);
+		glTextureStorage2D(mId, 1, mInternalFormat, mWidth, mHeight);
+
+		glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(mId, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(mId, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+		if (!sUploadBuffer)
+			glCreateBuffers(1, &sUploadBuffer);
+	}
+
+	void OpenGLTexture2D::UploadRows(const byte* pixels, const uint32 firstRow, const uint32 rowCount)
+	{
+		RB_PROFILE_FUNC();
+		const uint32 size = mWidth * rowCount * (mDataFormat == GL_RGBA ? 4 : 3);
+		const void* payload = RenderThread::CopyPayload(pixels, size);
+		RenderThread::Submit([id = mId, width = mWidth, format = mDataFormat, firstRow, rowCount, size, payload]()
+			{
+				// Orphaning hands back fresh storage, so this never waits on the copy of the previous chunk
+				glNamedBufferData(sUploadBuffer, size, nullptr, GL_STREAM_DRAW);
+				glNamedBufferSubData(sUploadBuffer, 0, size, payload);
+
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, sUploadBuffer);
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+				glTextureSubImage2D(id, 0, 0, firstRow, width, rowCount, format, GL_UNSIGNED_BYTE, nullptr);
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			});
+	}
+
+	void OpenGLTexture2D::EndUpload()
+	{
+		mPending = false;
+		mLoaded = true;
+		RB_CORE_TRACE("Texture {} loaded", mPath);
 	}
 
 }
@@ -30,13 +30,16 @@ namespace rebirth
 	class OpenGLTexture2D : public Texture2D
 	{
 	public:
-		OpenGLTexture2D(const std::string& path);
+		// An async texture is left empty for the TextureStreamer to fill
+		OpenGLTexture2D(const std::string& path, bool async = false);
 		OpenGLTexture2D(uint32 width, uint32 height);
 		virtual ~OpenGLTexture2D();
 
 		void Bind(uint32 slot = 0) const override;
 
 		void SetData(void* data, uint32 size) override;
+		void SetSubData(const void* data, uint32 x, uint32 y, uint32 width, uint32 height) override;
+		bool ReadPixels(std::vector<byte>& outData) const override;
 
 		int GetWidth() const override
 		{
@@ -48,23 +51,38 @@ namespace rebirth
 			return mHeight;
 		}
 
-		uint32 GetId() const override { return mId; }
+		uint32 GetId() const override;
 
 		const std::string& GetPath() const override { return mPath; }
+		uint32 GetMipLevels() const override { return mMipLevels; }
+		uint64 GetMemorySize() const override;
 
 		bool IsLoaded() const override { return mLoaded; }
 
 		bool operator==(const Texture& other) const override
 		{
-			return mId == other.GetId();
+			return GetId() == other.GetId();
 		}
+
+	protected:
+		void BeginUpload(uint32 width, uint32 height, uint32 channels) override;
+		void UploadRows(const byte* pixels, uint32 firstRow, uint32 rowCount) override;
+		void EndUpload() override;
+
 	private:
+		bool LoadCooked(const std::string& cookedPath);
+
 		int mWidth;
 		int mHeight;
-		uint32 mId;
+		uint32 mId = 0;
 		uint32 mInternalFormat;
 		uint32 mDataFormat;
+		uint64 mMemorySize = 0;
+		uint32 mMipLevels = 1;
+		bool mCompressed = false;
 		bool mLoaded = false;
+		// Still streaming in, the default texture stands in for it
+		bool mPending = false;
 
 		std::string mPath;
 	};
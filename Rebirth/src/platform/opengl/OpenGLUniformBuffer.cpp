@@ -22,6 +22,7 @@
 // ------------------------------------------------------------------------------
 #include "rbpch.h"
 #include "OpenGLUniformBuffer.h"
+#include "rebirth/renderer/RenderThread.h"
 
 #include <glad/glad.h>
 
@@ -31,19 +32,23 @@ namespace rebirth
 
 	OpenGLUniformBuffer::OpenGLUniformBuffer(uint32 size, uint32 binding)
 	{
-		glCreateBuffers(1, &mId);
-		glNamedBufferData(mId, size, nullptr, GL_DYNAMIC_DRAW);
-		glBindBufferBase(GL_UNIFORM_BUFFER, binding, mId);
+		RenderThread::Invoke([this, size, binding]()
+			{
+				glCreateBuffers(1, &mId);
+				glNamedBufferData(mId, size, nullptr, GL_DYNAMIC_DRAW);
+				glBindBufferBase(GL_UNIFORM_BUFFER, binding, mId);
+			});
 	}
 
 	OpenGLUniformBuffer::~OpenGLUniformBuffer()
 	{
-		glDeleteBuffers(1, &mId);
+		RenderThread::Submit([id = mId]() { glDeleteBuffers(1, &id); });
 	}
 
 	void OpenGLUniformBuffer::SetData(const void* data, uint32 size, uint32 offset /*= 0*/)
 	{
-		glNamedBufferSubData(mId, offset, size, data);
+		const void* payload = RenderThread::CopyPayload(data, size);
+		RenderThread::Submit([id = mId, payload, size, offset]() { glNamedBufferSubData(id, offset, size, payload); });
 	}
 
 }
@@ -24,6 +24,7 @@
 #include "rbpch.h"
 
 #include "OpenGLVertexArray.h"
+#include "rebirth/renderer/RenderThread.h"
 
 #include <glad/glad.h>
 
@@ -42,6 +43,12 @@ static GLenum GetGlType(const rebirth::ShaderDataType type)
 	case rebirth::ShaderDataType::INT3:
 	case rebirth::ShaderDataType::INT4: return GL_INT;
 	case rebirth::ShaderDataType::BOOL: return GL_BOOL;
+	case rebirth::ShaderDataType::UBYTE4_NORM: return GL_UNSIGNED_BYTE;
+	case rebirth::ShaderDataType::HALF:
+	case rebirth::ShaderDataType::HALF2: return GL_HALF_FLOAT;
+	case rebirth::ShaderDataType::SHORT2_NORM: return GL_SHORT;
+	case rebirth::ShaderDataType::USHORT2_NORM: return GL_UNSIGNED_SHORT;
+	case rebirth::ShaderDataType::UINT16: return GL_UNSIGNED_SHORT;
 	case rebirth::ShaderDataType::NONE: break;
 	}
 
@@ -55,25 +62,25 @@ namespace rebirth
 	OpenGLVertexArray::OpenGLVertexArray()
 	{
 		RB_PROFILE_FUNC();
-		glCreateVertexArrays(1, &mId);
+		RenderThread::Invoke([this]() { glCreateVertexArrays(1, &mId); });
 	}
 
 	OpenGLVertexArray::~OpenGLVertexArray()
 	{
 		RB_PROFILE_FUNC();
-		glDeleteVertexArrays(1, &mId);
+		RenderThread::Submit([id = mId]() { glDeleteVertexArrays(1, &id); });
 	}
 
 	void OpenGLVertexArray::Bind() const
 	{
 		RB_PROFILE_FUNC();
-		glBindVertexArray(mId);
+		RenderThread::Submit([id = mId]() { glBindVertexArray(id); });
 	}
 
 	void OpenGLVertexArray::Unbind() const
 	{
 		RB_PROFILE_FUNC();
-		glBindVertexArray(0);
+		RenderThread::Submit([]() { glBindVertexArray(0); });
 	}
 
 	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& buffer)
@@ -81,59 +88,73 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		RB_CORE_ASSERT(buffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout");
 
-		glBindVertexArray(mId);
-		buffer->Bind();
-		const auto& layout = buffer->GetLayout();
-		for (const auto& elem : layout)
-		{
-			switch (elem.type)
+		// Attribute setup touches the bound state, it runs on the render thread while no frame is executing
+		RenderThread::Invoke([this, &buffer]()
 			{
-				case rebirth::ShaderDataType::FLOAT:
-				case rebirth::ShaderDataType::FLOAT2:
-				case rebirth::ShaderDataType::FLOAT3:
-				case rebirth::ShaderDataType::FLOAT4:
+				glBindVertexArray(mId);
+				buffer->Bind();
+				const auto& layout = buffer->GetLayout();
+				for (const auto& elem : layout)
 				{
-					glEnableVertexAttribArray(mVertexBufferIndex);
-					glVertexAttribPointer(mVertexBufferIndex, elem.GetComponentCount(), GetGlType(elem.type),
-						elem.normalized ? GL_TRUE : GL_FALSE, layout.GetStride(),
-						reinterpret_cast<const void*>(static_cast<uintptr_t>(elem.offset)));
-					mVertexBufferIndex++;
-					break;
-				}
-				case rebirth::ShaderDataType::INT:
-				case rebirth::ShaderDataType::INT2:
-				case rebirth::ShaderDataType::INT3:
-				case rebirth::ShaderDataType::INT4:
-				case rebirth::ShaderDataType::BOOL:
-				{
-					glEnableVertexAttribArray(mVertexBufferIndex);
-					glVertexAttribIPointer(mVertexBufferIndex, elem.GetComponentCount(), GetGlType(elem.type),
-						layout.GetStride(),
-						reinterpret_cast<const void*>(static_cast<uintptr_t>(elem.offset)));
-					mVertexBufferIndex++;
-					break;
-				}
-				case rebirth::ShaderDataType::MAT3:
-				case rebirth::ShaderDataType::MAT4:
-				{
-					uint8_t count = elem.GetComponentCount();
-					for (uint8_t i = 0; i < count; i++)
+					switch (elem.type)
 					{
-						glEnableVertexAttribArray(mVertexBufferIndex);
-						glVertexAttribPointer(mVertexBufferIndex, count, GetGlType(elem.type),
-							elem.normalized ? GL_TRUE : GL_FALSE, layout.GetStride(),
-							reinterpret_cast<const void*>(static_cast<uintptr_t>(sizeof(float) * count * i)));
-						glVertexAttribDivisor(mVertexBufferIndex, 1);
-						mVertexBufferIndex++;
+						case rebirth::ShaderDataType::FLOAT:
+						case rebirth::ShaderDataType::FLOAT2:
+						case rebirth::ShaderDataType::FLOAT3:
+						case rebirth::ShaderDataType::FLOAT4:
+						case rebirth::ShaderDataType::UBYTE4_NORM:
+						case rebirth::ShaderDataType::HALF:
+						case rebirth::ShaderDataType::HALF2:
+						case rebirth::ShaderDataType::SHORT2_NORM:
+						case rebirth::ShaderDataType::USHORT2_NORM:
+						{
+							glEnableVertexAttribArray(mVertexBufferIndex);
+							glVertexAttribPointer(mVertexBufferIndex, elem.GetComponentCount(), GetGlType(elem.type),
+								elem.normalized ? GL_TRUE : GL_FALSE, layout.GetStride(),
+								reinterpret_cast<const void*>(static_cast<uintptr_t>(elem.offset)));
+							if (layout.IsPerInstance())
+								glVertexAttribDivisor(mVertexBufferIndex, 1);
+							mVertexBufferIndex++;
+							break;
+						}
+						case rebirth::ShaderDataType::INT:
+						case rebirth::ShaderDataType::INT2:
+						case rebirth::ShaderDataType::INT3:
+						case rebirth::ShaderDataType::INT4:
+						case rebirth::ShaderDataType::BOOL:
+						case rebirth::ShaderDataType::UINT16:
+						{
+							glEnableVertexAttribArray(mVertexBufferIndex);
+							glVertexAttribIPointer(mVertexBufferIndex, elem.GetComponentCount(), GetGlType(elem.type),
+								layout.GetStride(),
+								reinterpret_cast<const void*>(static_cast<uintptr_t>(elem.offset)));
+							if (layout.IsPerInstance())
+								glVertexAttribDivisor(mVertexBufferIndex, 1);
+							mVertexBufferIndex++;
+							break;
+						}
+						case rebirth::ShaderDataType::MAT3:
+						case rebirth::ShaderDataType::MAT4:
+						{
+							uint8_t count = elem.GetComponentCount();
+							for (uint8_t i = 0; i < count; i++)
+							{
+								glEnableVertexAttribArray(mVertexBufferIndex);
+								glVertexAttribPointer(mVertexBufferIndex, count, GetGlType(elem.type),
+									elem.normalized ? GL_TRUE : GL_FALSE, layout.GetStride(),
+									reinterpret_cast<const void*>(static_cast<uintptr_t>(sizeof(float) * count * i)));
+								glVertexAttribDivisor(mVertexBufferIndex, 1);
+								mVertexBufferIndex++;
+							}
+							break;
+						}
+						case rebirth::ShaderDataType::NONE:
+						default:
+							RB_CORE_ASSERT(false, "Unknown shader data type");
+
 					}
-					break;
 				}
-				case rebirth::ShaderDataType::NONE:
-				default:
-					RB_CORE_ASSERT(false, "Unknown shader data type");
-
-			}
-		}
+			});
 
 		mVertexBuffers.push_back(buffer);
 	}
@@ -141,8 +162,11 @@ namespace rebirth
 	void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& buffer)
 	{
 		RB_PROFILE_FUNC();
-		glBindVertexArray(mId);
-		buffer->Bind();
+		RenderThread::Invoke([this, &buffer]()
+			{
+				glBindVertexArray(mId);
+				buffer->Bind();
+			});
 		mIndexBuffer = buffer;
 	}
 }
\ No newline at end of file
@@ -29,7 +29,9 @@
 #include "rebirth/events/MouseEvent.h"
 
 #include "platform/opengl/OpenGLContext.h"
+#include "platform/null/NullWindow.h"
 #include "../../rebirth/renderer/Renderer.h"
+#include "rebirth/renderer/RenderThread.h"
 
 namespace rebirth
 {
@@ -37,6 +39,8 @@ namespace rebirth
 
 	Scope<Window> Window::Create(const ApplicationDesc& props)
 	{
+		if (props.headless)
+			return createScope<NullWindow>(props);
 		return createScope<Win64Window>(props);
 	}
 
@@ -62,20 +66,26 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 		glfwPollEvents();
-		mContext->SwapBuffers();
+
+		GraphicsContext* context = mContext.get();
+		RenderThread::Submit([context]() { context->SwapBuffers(); });
 	}
 
 	void Win64Window::SetVSync(bool enabled)
 	{
 		RB_PROFILE_FUNC();
-		if (enabled)
-		{
-			glfwSwapInterval(1);
-		}
-		else
-		{
-			glfwSwapInterval(0);
-		}
+		// The swap interval belongs to the context, so it's set on whichever thread owns it
+		RenderThread::Submit([enabled]()
+			{
+				if (enabled)
+				{
+					glfwSwapInterval(1);
+				}
+				else
+				{
+					glfwSwapInterval(0);
+				}
+			});
 
 		mData.vSync = enabled;
 	}
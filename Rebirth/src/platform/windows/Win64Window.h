@@ -51,6 +51,7 @@ namespace rebirth
 		float GetHighDPIScaleFactor() const override { return mHighDpiScaleFactor; }
 
 		void* GetNativeWindow() const override { return mWindow; }
+		GraphicsContext* GetContext() const override { return mContext.get(); }
 	private:
 		GLFWwindow* mWindow;
 		Scope<GraphicsContext> mContext;
@@ -26,10 +26,16 @@
 #include "Application.h"
 
 #include "rebirth/renderer/Renderer.h"
+#include "rebirth/renderer/RenderThread.h"
+#include "rebirth/renderer/TextureStreamer.h"
+#include "rebirth/renderer/TextureCache.h"
 #include "rebirth/util/PlatformUtil.h"
 #include "rebirth/debug/Statistics.h"
 #include "rebirth/imgui/Panels.h"
+#include "platform/null/NullCommandLog.h"
 #include "Assets.h"
+#include "Pack.h"
+#include "JobSystem.h"
 
 // temp
 #include <glfw/glfw3.h>
@@ -45,20 +51,50 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		RB_CORE_ASSERT(!sInstance, "Application already exists");
 		sInstance = this;
+
+		for (int i = 1; i < cmd.count; i++)
+		{
+			if (std::strcmp(cmd[i], "--headless") == 0)
+				appDesc.headless = true;
+			else if (std::strcmp(cmd[i], "--render-thread") == 0)
+				appDesc.renderThread = true;
+			else if (std::strcmp(cmd[i], "--frames") == 0 && i + 1 < cmd.count)
+				appDesc.frameLimit = (uint32)std::strtoul(cmd[++i], nullptr, 10);
+		}
+		mHeadless = appDesc.headless;
+		mFrameLimit = appDesc.frameLimit;
+
+		if (mHeadless)
+		{
+			// Before anything creates graphics resources
+			GraphicsAPI::SetAPI(GraphicsAPI::API::NULL_RECORDING);
+			// There is no context to hand over
+			appDesc.renderThread = false;
+		}
+
 		Panels::Init();
 		RB_CORE_INFO("Creating core application");
 		Time::Init();
+		JobSystem::Init(appDesc.jobThreads);
 		mWindow = Window::Create(appDesc);
 		mWindow->SetEventCallback(std::bind(&Application::HandleEvents, this, std::placeholders::_1));
+		if (!appDesc.assetPack.empty() && std::filesystem::exists(appDesc.assetPack))
+			Pack::Mount(appDesc.assetPack);
+		TextureCache::SetBudget(appDesc.textureCacheBudget);
 		Assets::Init();
 		Panels::PostInit();
 
+		if (appDesc.renderThread)
+			RenderThread::Start(mWindow->GetContext());
 
-		Renderer::Init();
-
+		Renderer::Init(appDesc.instancedQuads);
+		TextureStreamer::Init(appDesc.textureUploadBudget);
 
-		mImguiLayer = new ImguiLayer();
-		PushOverlay(mImguiLayer);
+		if (!mHeadless)
+		{
+			mImguiLayer = new ImguiLayer();
+			PushOverlay(mImguiLayer);
+		}
 
 		mDispatcher.AddListener(this);
 		RB_CORE_TRACE("Core application created");
@@ -68,7 +104,15 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 		RB_CORE_INFO("Shutting down application");
+		// Hands the context back to this thread, anything released afterwards runs inline
+		RenderThread::Stop();
+		// Before the renderer, pending callbacks reference its texture atlas
+		TextureStreamer::Shutdown();
+		// Finishes the jobs still queued while everything they could touch is alive
+		JobSystem::Shutdown();
+		TextureCache::Clear();
 		Renderer::Shutdown();
+		Pack::UnmountAll();
 	}
 
 	void Application::Close()
@@ -82,6 +126,7 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		float accumulator = 0;
 		int fps = 0;
+		uint32 frames = 0;
 		while (mRunning)
 		{
 			RB_PROFILE_SCOPE("Run Loop");
@@ -91,6 +136,9 @@ namespace rebirth
 			accumulator += timestep;
 			mLastFrameTime = time;
 
+			TextureStreamer::Update();
+			TextureCache::Trim();
+
 			if (!mMinimized)
 			{
 				RB_PROFILE_SCOPE("Update LayerStack");
@@ -98,19 +146,23 @@ namespace rebirth
 				{
 					layer->OnUpdate(timestep);
 				}
-				mImguiLayer->Begin();
+				if (mImguiLayer)
 				{
-					RB_PROFILE_SCOPE("LayerStack render imgui");
-					for (Layer* layer : mLayerStack)
+					mImguiLayer->Begin();
 					{
-						layer->OnImguiRender();
+						RB_PROFILE_SCOPE("LayerStack render imgui");
+						for (Layer* layer : mLayerStack)
+						{
+							layer->OnImguiRender();
+						}
 					}
+					mImguiLayer->End();
 				}
-				mImguiLayer->End();
 			}
 
 			++fps;
 			mWindow->OnUpdate();
+			RenderThread::Kick();
 			mDispatcher.PollEvents();
 
 			if (accumulator >= 1.0f)
@@ -119,6 +171,16 @@ namespace rebirth
 				accumulator = 0;
 				fps = 0;
 			}
+
+			if (mFrameLimit && ++frames >= mFrameLimit)
+				Close();
+		}
+
+		if (mHeadless)
+		{
+			const NullCommandTotals totals = NullCommandLog::GetTotals();
+			RB_CORE_INFO("Headless run recorded {0} draw calls, {1} indices, {2} binds, {3} uploads ({4} bytes)",
+						 totals.drawCalls, totals.indices, totals.binds, totals.uploads, totals.bytesUploaded);
 		}
 	}
 
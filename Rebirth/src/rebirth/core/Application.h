@@ -73,6 +73,7 @@ namespace rebirth
 		void OnWindowResize(WindowResizeEvent& e) override;
 
 		Window& GetWindow() const { return *mWindow; }
+		// Null when running headless
 		ImguiLayer* GetImguiLayer() { return mImguiLayer; }
 
 		CommandLineArgs GetCommandLineArgs() const { return mCommandLine; }
@@ -80,6 +81,7 @@ namespace rebirth
 		EventDispatcher& GetEventDispatcher() { return mDispatcher; }
 
 		static Application& Instance() { return *sInstance; }
+		static bool HasInstance() { return sInstance != nullptr; }
 
 	private:
 
@@ -90,8 +92,10 @@ namespace rebirth
 		EventDispatcher mDispatcher;
 
 		LayerStack mLayerStack;
-		ImguiLayer* mImguiLayer;
+		ImguiLayer* mImguiLayer = nullptr;
 		float mLastFrameTime = 0.0f;
+		uint32 mFrameLimit = 0;
+		bool mHeadless = false;
 
 		bool mRunning = true;
 		bool mMinimized = false;
@@ -41,6 +41,32 @@ namespace rebirth
 		uint32 windowWidth = 1920;
 		uint32 windowHeight = 1080;
 		int32 flags = WindowFlag_None;
+
+		// Draw Renderer2D quads with the instanced pipeline rather than expanding them on the CPU
+		bool instancedQuads = false;
+
+		// Record graphics commands on the main thread and replay them on a dedicated render thread a frame behind.
+		// Also enabled by the --render-thread switch
+		bool renderThread = false;
+
+		// Workers started by the JobSystem, 0 uses one per core besides the main thread
+		uint32 jobThreads = 0;
+
+		// Bytes of streamed texture data uploaded per frame, see Texture2D::CreateAsync
+		uint32 textureUploadBudget = 4 * 1024 * 1024;
+
+		// Bytes of file textures kept resident before unused ones are evicted, see TextureCache
+		uint64 textureCacheBudget = 512ull * 1024 * 1024;
+
+		// Asset pack mounted before anything loads, if it exists. See Pack
+		std::string assetPack = "assets.rbpak";
+
+		// Run without a window or GPU, graphics commands only go to the NullCommandLog, which totals them.
+		// Also enabled by the --headless switch
+		bool headless = false;
+
+		// Frames to run before the application closes itself, 0 runs until closed. Also set by --frames N
+		uint32 frameLimit = 0;
 	};
 }
 
@@ -0,0 +1,364 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: JobSystem.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "JobSystem.h"
+
+#include <condition_variable>
+
+namespace rebirth
+{
+	static constexpr uint32 sNoThread = UINT32_MAX;
+
+	// Slots checked for a finished job before falling back to the heap
+	static constexpr uint32 sAllocateTries = 8;
+
+	// Chase-Lev work stealing deque. Only the owner pushes and pops at the bottom, any thread steals from the top
+	template<typename T, uint32 Capacity>
+	class StealDeque
+	{
+	public:
+		static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+		bool Push(T* item)
+		{
+			int64 bottom = mBottom.load(std::memory_order_relaxed);
+			int64 top = mTop.load(std::memory_order_acquire);
+			if (bottom - top >= (int64)Capacity)
+				return false;
+
+			mItems[bottom & (Capacity - 1)].store(item, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		T* Pop()
+		{
+			int64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64 top = mTop.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* item = mItems[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last item, race the thieves for it
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					item = nullptr;
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return item;
+		}
+
+		T* Steal()
+		{
+			int64 top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64 bottom = mBottom.load(std::memory_order_acquire);
+			if (top >= bottom)
+				return nullptr;
+
+			T* item = mItems[top & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+			return item;
+		}
+
+	private:
+		alignas(64) std::atomic<int64> mTop = 0;
+		alignas(64) std::atomic<int64> mBottom = 0;
+		std::array<std::atomic<T*>, Capacity> mItems;
+	};
+
+	struct JobSystem::JobThread
+	{
+		StealDeque<Job, DEQUE_CAPACITY> deque;
+		std::array<Job, JOB_POOL_SIZE> pool;
+		uint32 nextJob = 0; // Owner only
+	};
+
+	std::atomic<bool> JobSystem::sRunning = false;
+	uint32 JobSystem::sWorkerCount = 0;
+	std::vector<JobSystem::JobThread*> JobSystem::sThreads;
+	std::vector<std::thread> JobSystem::sWorkers;
+	std::mutex JobSystem::sQueueMutex;
+	std::deque<JobSystem::Job*> JobSystem::sInjected;
+	std::deque<JobSystem::Job*> JobSystem::sBackground;
+
+	static thread_local uint32 sThreadIndex = sNoThread;
+
+	static std::atomic<int32> sInjectedCount = 0;
+	static std::atomic<int32> sBackgroundCount = 0;
+	static std::atomic<int32> sBackgroundRunning = 0;
+	static int32 sMaxBackground = 1;
+
+	// Queued normal jobs, a worker only sleeps while this is zero and no background job may start
+	static std::atomic<int32> sQueued = 0;
+	static std::atomic<int32> sOutstanding = 0;
+
+	static std::mutex sSleepMutex;
+	static std::condition_variable sWake;
+	static std::atomic<int32> sSleeping = 0;
+
+	static bool HasWork()
+	{
+		return sQueued.load() > 0 || (sBackgroundCount.load() > 0 && sBackgroundRunning.load() < sMaxBackground);
+	}
+
+	static void WakeWorker()
+	{
+		// Sleepers count themselves before checking for work, so either they see the job or we see them
+		if (sSleeping.load() > 0)
+		{
+			std::lock_guard lock(sSleepMutex);
+			sWake.notify_one();
+		}
+	}
+
+	void JobSystem::Init(uint32 workerCount)
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!IsRunning(), "Job system is already running");
+
+		if (workerCount == 0)
+			workerCount = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1;
+
+		sWorkerCount = workerCount;
+		sMaxBackground = (int32)std::max(1u, workerCount / 2);
+
+		for (uint32 i = 0; i <= workerCount; i++)
+			sThreads.push_back(new JobThread());
+
+		sThreadIndex = 0;
+		sRunning.store(true, std::memory_order_release);
+		for (uint32 i = 1; i <= workerCount; i++)
+			sWorkers.emplace_back(&JobSystem::WorkerMain, i);
+
+		RB_CORE_TRACE("Job system started with {} workers", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		RB_PROFILE_FUNC();
+		if (!IsRunning())
+			return;
+
+		// Submitters may be holding on to state until their jobs are done, so nothing is dropped
+		while (sOutstanding.load() > 0)
+		{
+			if (Job* job = FindJob(true))
+				Run(job);
+			else
+				std::this_thread::yield();
+		}
+
+		{
+			std::lock_guard lock(sSleepMutex);
+			sRunning.store(false, std::memory_order_release);
+		}
+		sWake.notify_all();
+
+		for (auto& worker : sWorkers)
+			worker.join();
+		sWorkers.clear();
+
+		for (JobThread* thread : sThreads)
+			delete thread;
+		sThreads.clear();
+
+		sThreadIndex = sNoThread;
+		sWorkerCount = 0;
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (Job* job = FindJob(false))
+				Run(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	JobSystem::Job* JobSystem::AllocateJob(const bool background)
+	{
+		// Background jobs can hold on to a slot for a long time, they'd only crowd the ring
+		if (!background && sThreadIndex != sNoThread)
+		{
+			JobThread& thread = *sThreads[sThreadIndex];
+			for (uint32 i = 0; i < sAllocateTries; i++)
+			{
+				Job& job = thread.pool[thread.nextJob++ & (JOB_POOL_SIZE - 1)];
+				if (!job.busy.load(std::memory_order_acquire))
+				{
+					job.busy.store(true, std::memory_order_relaxed);
+					job.heap = false;
+					return &job;
+				}
+			}
+		}
+
+		Job* job = new Job();
+		job->heap = true;
+		return job;
+	}
+
+	void JobSystem::Push(Job* job)
+	{
+		sOutstanding.fetch_add(1);
+
+		if (job->background)
+		{
+			std::lock_guard lock(sQueueMutex);
+			sBackground.push_back(job);
+			sBackgroundCount.fetch_add(1);
+		}
+		else
+		{
+			// Counted before it's visible, a worker woken early just looks again
+			sQueued.fetch_add(1);
+			if (sThreadIndex == sNoThread || !sThreads[sThreadIndex]->deque.Push(job))
+			{
+				std::lock_guard lock(sQueueMutex);
+				sInjected.push_back(job);
+				sInjectedCount.fetch_add(1);
+			}
+		}
+
+		WakeWorker();
+	}
+
+	JobSystem::Job* JobSystem::FindJob(const bool allowBackground)
+	{
+		const uint32 threadCount = (uint32)sThreads.size();
+		if (sThreadIndex != sNoThread)
+		{
+			if (Job* job = sThreads[sThreadIndex]->deque.Pop())
+			{
+				sQueued.fetch_sub(1);
+				return job;
+			}
+		}
+
+		if (sInjectedCount.load() > 0)
+		{
+			std::lock_guard lock(sQueueMutex);
+			if (!sInjected.empty())
+			{
+				Job* job = sInjected.front();
+				sInjected.pop_front();
+				sInjectedCount.fetch_sub(1);
+				sQueued.fetch_sub(1);
+				return job;
+			}
+		}
+
+		// Starts at a different victim each time so the thieves spread out
+		static thread_local uint32 nextVictim = 0;
+		for (uint32 i = 0; i < threadCount; i++)
+		{
+			uint32 victim = (nextVictim + i) % threadCount;
+			if (victim == sThreadIndex)
+				continue;
+
+			if (Job* job = sThreads[victim]->deque.Steal())
+			{
+				nextVictim = victim;
+				sQueued.fetch_sub(1);
+				return job;
+			}
+		}
+		nextVictim++;
+
+		if (allowBackground && sBackgroundCount.load() > 0 && sBackgroundRunning.load() < sMaxBackground)
+		{
+			std::lock_guard lock(sQueueMutex);
+			if (!sBackground.empty() && sBackgroundRunning.load() < sMaxBackground)
+			{
+				Job* job = sBackground.front();
+				sBackground.pop_front();
+				sBackgroundCount.fetch_sub(1);
+				sBackgroundRunning.fetch_add(1);
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void JobSystem::Run(Job* job)
+	{
+		{
+			RB_PROFILE_SCOPE(job->name);
+			job->function(*job);
+		}
+
+		JobCounter* counter = job->counter;
+		const bool background = job->background;
+		if (job->heap)
+			delete job;
+		else
+			job->busy.store(false, std::memory_order_release);
+
+		if (background)
+		{
+			// Lets a sleeping worker pick up the next one
+			sBackgroundRunning.fetch_sub(1);
+			if (sBackgroundCount.load() > 0)
+				WakeWorker();
+		}
+
+		if (counter)
+			counter->mCount.fetch_sub(1, std::memory_order_acq_rel);
+		sOutstanding.fetch_sub(1);
+	}
+
+	void JobSystem::WorkerMain(const uint32 index)
+	{
+		sThreadIndex = index;
+
+		while (true)
+		{
+			if (Job* job = FindJob(true))
+			{
+				Run(job);
+				continue;
+			}
+
+			std::unique_lock lock(sSleepMutex);
+			if (!IsRunning())
+				return;
+
+			sSleeping.fetch_add(1);
+			sWake.wait(lock, []() { return HasWork() || !IsRunning(); });
+			sSleeping.fetch_sub(1);
+		}
+	}
+}
@@ -0,0 +1,194 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: JobSystem.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <thread>
+#include <mutex>
+#include <deque>
+
+namespace rebirth
+{
+	// Number of jobs still to finish. Hand one to the jobs that make up some piece of work and
+	// JobSystem::Wait on it, the waiting thread runs other jobs until it reaches zero
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return mCount.load(std::memory_order_acquire) == 0; }
+		uint32 GetCount() const { return mCount.load(std::memory_order_relaxed); }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32> mCount = 0;
+	};
+
+	// Work stealing thread pool. Every job thread, the one that called Init included, pushes its jobs onto its
+	// own Chase-Lev deque and pops them back in LIFO order, idle threads steal the oldest job of another.
+	// Jobs come from a ring owned by the submitting thread, so small jobs never lock or allocate.
+	// Threads that aren't job threads submit through a shared queue instead.
+	// Background jobs are for long running work like decoding a file. They go through their own queue, only
+	// run on half the workers at most and are never picked up by a Wait, so they can't stall a frame.
+	// Each job shows up in the profiler under its name, which must be a string literal.
+	// Before Init and after Shutdown jobs run inline on the submitting thread
+	class JobSystem
+	{
+	public:
+		// Callables up to this size are stored in the job itself, bigger ones are allocated
+		static constexpr uint32 JOB_DATA_SIZE = 64;
+		static constexpr uint32 JOB_POOL_SIZE = 1024;
+		static constexpr uint32 DEQUE_CAPACITY = 4096;
+
+		// 0 uses one worker per core besides the calling thread. There's always at least one worker
+		static void Init(uint32 workerCount = 0);
+		// Runs whatever is still queued, then joins the workers
+		static void Shutdown();
+		static bool IsRunning() { return sRunning.load(std::memory_order_acquire); }
+
+		static uint32 GetWorkerCount() { return sWorkerCount; }
+		// Workers plus the thread that waits, how many ways it's worth splitting work
+		static uint32 GetThreadCount() { return IsRunning() ? sWorkerCount + 1 : 1; }
+
+		template<typename Fn>
+		static void Execute(const char* name, Fn&& fn, JobCounter* counter = nullptr)
+		{
+			Submit(name, std::forward<Fn>(fn), counter, false);
+		}
+
+		template<typename Fn>
+		static void ExecuteBackground(const char* name, Fn&& fn, JobCounter* counter = nullptr)
+		{
+			Submit(name, std::forward<Fn>(fn), counter, true);
+		}
+
+		// Calls fn(begin, end) over [0, count) in batches of batchSize, the calling thread takes the last batch
+		// and returns once every batch is done
+		template<typename Fn>
+		static void ParallelFor(const char* name, uint32 count, uint32 batchSize, const Fn& fn)
+		{
+			batchSize = std::max(1u, batchSize);
+			if (count <= batchSize || !IsRunning())
+			{
+				RB_PROFILE_SCOPE(name);
+				fn(0, count);
+				return;
+			}
+
+			JobCounter counter;
+			uint32 begin = 0;
+			for (; begin + batchSize < count; begin += batchSize)
+			{
+				Execute(name, [&fn, begin, batchSize]() { fn(begin, begin + batchSize); }, &counter);
+			}
+
+			{
+				RB_PROFILE_SCOPE(name);
+				fn(begin, count);
+			}
+			Wait(counter);
+		}
+
+		// Runs other jobs until the counter reaches zero. Safe to call from inside a job
+		static void Wait(const JobCounter& counter);
+
+	private:
+		struct alignas(64) Job
+		{
+			void (*function)(Job& job) = nullptr; // Runs the callable in data, then destroys it
+			JobCounter* counter = nullptr;
+			const char* name = nullptr;
+			bool background = false;
+			bool heap = false;
+			std::atomic<bool> busy = false;
+			alignas(std::max_align_t) byte data[JOB_DATA_SIZE];
+		};
+
+		template<typename Fn>
+		static void Submit(const char* name, Fn&& fn, JobCounter* counter, bool background)
+		{
+			using Callable = std::decay_t<Fn>;
+			if (!IsRunning())
+			{
+				RB_PROFILE_SCOPE(name);
+				fn();
+				return;
+			}
+
+			Job* job = AllocateJob(background);
+			if constexpr (sizeof(Callable) <= JOB_DATA_SIZE && alignof(Callable) <= alignof(std::max_align_t))
+			{
+				new (job->data) Callable(std::forward<Fn>(fn));
+				job->function = [](Job& job)
+				{
+					Callable* callable = std::launder((Callable*)job.data);
+					(*callable)();
+					callable->~Callable();
+				};
+			}
+			else
+			{
+				*(Callable**)job->data = new Callable(std::forward<Fn>(fn));
+				job->function = [](Job& job)
+				{
+					Callable* callable = *(Callable**)job.data;
+					(*callable)();
+					delete callable;
+				};
+			}
+
+			job->name = name;
+			job->counter = counter;
+			job->background = background;
+			if (counter)
+				counter->mCount.fetch_add(1, std::memory_order_relaxed);
+
+			Push(job);
+		}
+
+		struct JobThread;
+
+		static Job* AllocateJob(bool background);
+		static void Push(Job* job);
+		static Job* FindJob(bool allowBackground);
+		static void Run(Job* job);
+		static void WorkerMain(uint32 index);
+
+		static std::atomic<bool> sRunning;
+		static uint32 sWorkerCount;
+
+		// Index 0 is the thread that called Init, the workers follow
+		static std::vector<JobThread*> sThreads;
+		static std::vector<std::thread> sWorkers;
+
+		// Jobs from threads without a deque, or whose deque was full, and the background jobs
+		static std::mutex sQueueMutex;
+		static std::deque<Job*> sInjected;
+		static std::deque<Job*> sBackground;
+	};
+}
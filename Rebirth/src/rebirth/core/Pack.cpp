@@ -0,0 +1,368 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Pack.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "Pack.h"
+
+#include "rebirth/util/Lz4.h"
+#include "rebirth/util/PlatformUtil.h"
+
+#include <fstream>
+
+namespace rebirth
+{
+	// "RBPK", bump the version whenever a record changes
+	static constexpr uint32 sArchiveMagic = 0x4b504252;
+	static constexpr uint32 sArchiveVersion = 1;
+
+	// Entry data starts on a page boundary, so mapped views line up with what the OS pages in
+	static constexpr uint64 sEntryAlignment = 4096;
+
+	enum ArchiveEntryFlags : uint32
+	{
+		ArchiveEntry_Compressed = BIT(0)
+	};
+
+	struct ArchiveHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 entryCount;
+		uint32 bucketCount;
+		uint64 entriesOffset;
+		uint64 bucketsOffset;
+		uint64 stringsOffset;
+		uint64 stringsSize;
+	};
+
+	struct ArchiveEntry
+	{
+		uint64 hash;
+		uint32 pathOffset; // into the strings
+		uint32 pathSize;
+		uint64 offset;
+		uint64 storedSize;
+		uint64 size;
+		uint32 flags;
+		uint32 padding;
+	};
+
+	// The tables are read straight out of the mapping
+	static_assert(sizeof(ArchiveHeader) % 8 == 0 && sizeof(ArchiveEntry) % 8 == 0, "Archive records must stay 8 byte aligned");
+
+	struct MountedPack
+	{
+		std::string filepath;
+		MappedFile file;
+		const ArchiveHeader* header = nullptr;
+		const ArchiveEntry* entries = nullptr;
+		const uint32* buckets = nullptr; // entry index + 1, 0 is empty
+		const char* strings = nullptr;
+	};
+
+	static std::vector<Scope<MountedPack>> sPacks;
+
+	static uint64 HashPath(const std::string& path)
+	{
+		uint64 hash = 14695981039346656037ull;
+		for (char c : path)
+		{
+			hash ^= (byte)c;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	static uint64 Align(const uint64 offset, const uint64 alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	static bool InFile(const MappedFile& file, const uint64 offset, const uint64 size)
+	{
+		return offset <= file.GetSize() && size <= file.GetSize() - offset;
+	}
+
+	static std::string_view GetPath(const MountedPack& pack, const ArchiveEntry& entry)
+	{
+		return std::string_view(pack.strings + entry.pathOffset, entry.pathSize);
+	}
+
+	// Checks every range up front so reads never have to
+	static bool Validate(MountedPack& pack)
+	{
+		const MappedFile& file = pack.file;
+		if (file.GetSize() < sizeof(ArchiveHeader))
+			return false;
+
+		const ArchiveHeader& header = *(const ArchiveHeader*)file.GetData();
+		if (header.magic != sArchiveMagic || header.version != sArchiveVersion)
+			return false;
+
+		const bool powerOfTwo = header.bucketCount && (header.bucketCount & (header.bucketCount - 1)) == 0;
+		if (!powerOfTwo || header.bucketCount < header.entryCount
+			|| header.entriesOffset % 8 || header.bucketsOffset % 4
+			|| !InFile(file, header.entriesOffset, (uint64)header.entryCount * sizeof(ArchiveEntry))
+			|| !InFile(file, header.bucketsOffset, (uint64)header.bucketCount * sizeof(uint32))
+			|| !InFile(file, header.stringsOffset, header.stringsSize))
+			return false;
+
+		pack.header = &header;
+		pack.entries = (const ArchiveEntry*)(file.GetData() + header.entriesOffset);
+		pack.buckets = (const uint32*)(file.GetData() + header.bucketsOffset);
+		pack.strings = (const char*)(file.GetData() + header.stringsOffset);
+
+		for (uint32 i = 0; i < header.entryCount; i++)
+		{
+			const ArchiveEntry& entry = pack.entries[i];
+			if ((uint64)entry.pathOffset + entry.pathSize > header.stringsSize || !InFile(file, entry.offset, entry.storedSize))
+				return false;
+
+			// Blocks are decompressed with 32 bit sizes
+			if ((entry.flags & ArchiveEntry_Compressed) && (entry.storedSize > UINT32_MAX || entry.size > UINT32_MAX))
+				return false;
+
+			if (!(entry.flags & ArchiveEntry_Compressed) && entry.storedSize != entry.size)
+				return false;
+		}
+
+		for (uint32 i = 0; i < header.bucketCount; i++)
+		{
+			if (pack.buckets[i] > header.entryCount)
+				return false;
+		}
+
+		return true;
+	}
+
+	static const ArchiveEntry* FindEntry(const MountedPack& pack, const std::string& key, const uint64 hash)
+	{
+		const uint32 mask = pack.header->bucketCount - 1;
+		for (uint32 probe = 0; probe < pack.header->bucketCount; probe++)
+		{
+			const uint32 slot = pack.buckets[(hash + probe) & mask];
+			if (!slot)
+				return nullptr;
+
+			const ArchiveEntry& entry = pack.entries[slot - 1];
+			if (entry.hash == hash && GetPath(pack, entry) == key)
+				return &entry;
+		}
+		return nullptr;
+	}
+
+	// Newest mount first, so a patch pack mounted later overrides the base one
+	template<typename Fn>
+	static bool FindInPacks(const std::string& path, Fn&& fn)
+	{
+		if (sPacks.empty())
+			return false;
+
+		const std::string key = Pack::NormalizePath(path);
+		const uint64 hash = HashPath(key);
+		for (auto it = sPacks.rbegin(); it != sPacks.rend(); ++it)
+		{
+			if (const ArchiveEntry* entry = FindEntry(**it, key, hash))
+				return fn(**it, *entry);
+		}
+		return false;
+	}
+
+	bool Pack::Mount(const std::string& filepath)
+	{
+		RB_PROFILE_FUNC();
+
+		Scope<MountedPack> pack = createScope<MountedPack>();
+		pack->filepath = filepath;
+		if (!pack->file.Open(filepath))
+			return false;
+
+		if (!Validate(*pack))
+		{
+			RB_CORE_WARN("{} is not an asset pack of version {}, ignoring it", filepath, sArchiveVersion);
+			return false;
+		}
+
+		RB_CORE_INFO("Mounted asset pack {} with {} entries", filepath, pack->header->entryCount);
+		sPacks.push_back(std::move(pack));
+		return true;
+	}
+
+	void Pack::UnmountAll()
+	{
+		sPacks.clear();
+	}
+
+	bool Pack::IsMounted()
+	{
+		return !sPacks.empty();
+	}
+
+	bool Pack::Exists(const std::string& path)
+	{
+		return FindInPacks(path, [](const MountedPack&, const ArchiveEntry&) { return true; });
+	}
+
+	bool Pack::Read(const std::string& path, PackView& outView)
+	{
+		return FindInPacks(path, [&](const MountedPack& pack, const ArchiveEntry& entry)
+			{
+				const byte* data = pack.file.GetData() + entry.offset;
+				if (!(entry.flags & ArchiveEntry_Compressed))
+				{
+					outView.mData = data;
+					outView.mSize = entry.size;
+					outView.mOwned = nullptr;
+					return true;
+				}
+
+				auto owned = createRef<std::vector<byte>>(entry.size);
+				if (!Lz4::Decompress(data, (uint32)entry.storedSize, owned->data(), (uint32)entry.size))
+				{
+					RB_CORE_ERROR("Entry {} of asset pack {} is corrupt", path, pack.filepath);
+					return false;
+				}
+
+				outView.mData = owned->data();
+				outView.mSize = entry.size;
+				outView.mOwned = std::move(owned);
+				return true;
+			});
+	}
+
+	bool Pack::Write(const std::string& filepath, const std::vector<PackFile>& files)
+	{
+		RB_PROFILE_FUNC();
+
+		std::vector<ArchiveEntry> entries(files.size());
+		std::vector<std::vector<byte>> blobs(files.size());
+		std::string strings;
+		std::unordered_set<std::string> keys;
+		for (size_t i = 0; i < files.size(); i++)
+		{
+			const PackFile& file = files[i];
+			std::string key = NormalizePath(file.path);
+			if (!keys.insert(key).second)
+			{
+				RB_CORE_ERROR("{} is in the pack more than once", key);
+				return false;
+			}
+
+			std::ifstream in(file.source, std::ios::binary);
+			if (!in)
+			{
+				RB_CORE_ERROR("Failed to open {} for the pack", file.source);
+				return false;
+			}
+			std::vector<byte> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+			ArchiveEntry& entry = entries[i];
+			entry.hash = HashPath(key);
+			entry.pathOffset = (uint32)strings.size();
+			entry.pathSize = (uint32)key.size();
+			entry.size = data.size();
+			entry.storedSize = data.size();
+			strings += key;
+
+			if (file.compress && !data.empty() && data.size() <= UINT32_MAX - UINT32_MAX / 255 - 16)
+			{
+				std::vector<byte> compressed(Lz4::GetMaxCompressedSize((uint32)data.size()));
+				uint32 size = Lz4::Compress(data.data(), (uint32)data.size(), compressed.data(), (uint32)compressed.size());
+				if (size && size < data.size())
+				{
+					compressed.resize(size);
+					data = std::move(compressed);
+					entry.storedSize = size;
+					entry.flags |= ArchiveEntry_Compressed;
+				}
+			}
+			blobs[i] = std::move(data);
+		}
+
+		ArchiveHeader header = {};
+		header.magic = sArchiveMagic;
+		header.version = sArchiveVersion;
+		header.entryCount = (uint32)entries.size();
+		header.bucketCount = 1;
+		// At most half full, so probes stay short
+		while (header.bucketCount < header.entryCount * 2)
+			header.bucketCount <<= 1;
+
+		std::vector<uint32> buckets(header.bucketCount, 0);
+		for (uint32 i = 0; i < header.entryCount; i++)
+		{
+			uint64 slot = entries[i].hash;
+			while (buckets[slot & (header.bucketCount - 1)])
+				slot++;
+			buckets[slot & (header.bucketCount - 1)] = i + 1;
+		}
+
+		header.entriesOffset = sizeof(ArchiveHeader);
+		header.bucketsOffset = header.entriesOffset + entries.size() * sizeof(ArchiveEntry);
+		header.stringsOffset = header.bucketsOffset + buckets.size() * sizeof(uint32);
+		header.stringsSize = strings.size();
+
+		uint64 offset = header.stringsOffset + header.stringsSize;
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			offset = Align(offset, sEntryAlignment);
+			entries[i].offset = offset;
+			offset += blobs[i].size();
+		}
+
+		std::ofstream out(filepath, std::ios::binary);
+		out.write((const char*)&header, sizeof(header));
+		out.write((const char*)entries.data(), entries.size() * sizeof(ArchiveEntry));
+		out.write((const char*)buckets.data(), buckets.size() * sizeof(uint32));
+		out.write(strings.data(), strings.size());
+
+		const std::vector<char> padding(sEntryAlignment, 0);
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			out.write(padding.data(), entries[i].offset - (uint64)out.tellp());
+			out.write((const char*)blobs[i].data(), blobs[i].size());
+		}
+
+		if (!out)
+		{
+			RB_CORE_ERROR("Failed to write asset pack {}", filepath);
+			return false;
+		}
+
+		return true;
+	}
+
+	std::string Pack::NormalizePath(const std::string& path)
+	{
+		std::filesystem::path normal = std::filesystem::path(path).lexically_normal();
+
+		// Asset paths are relative to the working directory, an absolute path under it gets the same key
+		if (normal.is_absolute())
+		{
+			std::error_code error;
+			std::filesystem::path root = std::filesystem::current_path(error);
+			if (!error)
+				normal = normal.lexically_proximate(root);
+		}
+		return normal.generic_string();
+	}
+}
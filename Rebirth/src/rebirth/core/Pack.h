@@ -0,0 +1,82 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Pack.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+namespace rebirth
+{
+	// Read only bytes of a pack entry. Stored entries point straight into the pack's mapping, compressed
+	// ones own their decompressed copy. Valid until the pack is unmounted
+	class PackView
+	{
+	public:
+		const byte* GetData() const { return mData; }
+		uint64 GetSize() const { return mSize; }
+		bool IsEmpty() const { return mSize == 0; }
+
+		const byte* begin() const { return mData; }
+		const byte* end() const { return mData + mSize; }
+
+		std::string_view AsString() const { return std::string_view((const char*)mData, mSize); }
+
+	private:
+		friend class Pack;
+
+		const byte* mData = nullptr;
+		uint64 mSize = 0;
+		Ref<std::vector<byte>> mOwned;
+	};
+
+	// A file for the pack, stored under path and read from source on disk
+	struct PackFile
+	{
+		std::string path;
+		std::string source;
+		bool compress = true;
+	};
+
+	// Archives of the assets under a single mapped file, so a cold start opens one file rather than thousands.
+	// Layout: header, entry table, hash buckets, path strings, then each entry's data 4K aligned. The buckets
+	// are an open addressed table of FNV-1a path hashes, entries are stored as is or as an LZ4 block.
+	// Loaders check the mounted packs before the disk, newest mount first. Mount and unmount before or after
+	// loading, reads are safe from any thread
+	class Pack
+	{
+	public:
+		static constexpr const char* DEFAULT_PATH = "assets.rbpak";
+
+		static bool Mount(const std::string& filepath);
+		static void UnmountAll();
+		static bool IsMounted();
+
+		static bool Exists(const std::string& path);
+		// False if no mounted pack has the path or its entry fails to decompress
+		static bool Read(const std::string& path, PackView& outView);
+
+		// Compressed entries that don't shrink are stored as is
+		static bool Write(const std::string& filepath, const std::vector<PackFile>& files);
+
+		// Relative, forward slashed and without "." or inner ".." parts, how paths are keyed in the pack. Absolute paths
+		// are made relative to the working directory, starting with ".." when outside it, and only stay absolute on another root
+		static std::string NormalizePath(const std::string& path);
+	};
+}
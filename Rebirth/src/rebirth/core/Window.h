@@ -28,6 +28,7 @@
 #include "rebirth/core/Common.h"
 #include "rebirth/events/Event.h"
 #include "ApplicationDesc.h"
+#include "rebirth/renderer/GraphicsContext.h"
 
 namespace rebirth
 {
@@ -50,6 +51,7 @@ namespace rebirth
 		virtual float GetHighDPIScaleFactor() const = 0;
 
 		virtual void* GetNativeWindow() const = 0;
+		virtual GraphicsContext* GetContext() const = 0;
 
 		static Scope<Window> Create(const ApplicationDesc& appDesc);
 	};
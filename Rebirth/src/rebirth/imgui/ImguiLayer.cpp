@@ -32,6 +32,7 @@
 #include <backends/imgui_impl_glfw.h>
 #include <ImGuizmo.h>
 #include "rebirth/core/Application.h"
+#include "rebirth/renderer/RenderThread.h"
 
 
 // temp
@@ -40,6 +41,26 @@
 
 namespace rebirth
 {
+	// Owns a deep copy of one frame's draw lists so the render thread can draw them after the next frame has begun
+	struct ImguiDrawDataCopy
+	{
+		ImDrawData drawData;
+		ImVector<ImDrawList*> cmdLists;
+
+		explicit ImguiDrawDataCopy(const ImDrawData* source) : drawData(*source)
+		{
+			cmdLists.resize(source->CmdListsCount);
+			for (int i = 0; i < source->CmdListsCount; i++)
+				cmdLists[i] = source->CmdLists[i]->CloneOutput();
+			drawData.CmdLists = cmdLists.Data;
+		}
+
+		~ImguiDrawDataCopy()
+		{
+			for (ImDrawList* list : cmdLists)
+				IM_DELETE(list);
+		}
+	};
 
 	static void Style()
 	{
@@ -163,7 +184,9 @@ namespace rebirth
 
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;       // Enable Keyboard Controls
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+		// Platform windows render through their own contexts on the main thread, so they only work unthreaded
+		if (!RenderThread::IsRunning())
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
 
 		// #FIX: Right now this loads from the editor filepath - not good for sandbox
 		// #TODO: Font size should be able to change via user preferences in the editor
@@ -180,14 +203,19 @@ namespace rebirth
 		auto window = static_cast<GLFWwindow*>(app.GetWindow().GetNativeWindow());
 
 		ImGui_ImplGlfw_InitForOpenGL(window, true);
-		ImGui_ImplOpenGL3_Init("#version 410");
+		// Create the device objects up front, NewFrame would otherwise create them on the main thread
+		RenderThread::Invoke([]()
+			{
+				ImGui_ImplOpenGL3_Init("#version 410");
+				ImGui_ImplOpenGL3_CreateDeviceObjects();
+			});
 
 	}
 
 	void ImguiLayer::OnDetach()
 	{
 		RB_PROFILE_FUNC();
-		ImGui_ImplOpenGL3_Shutdown();
+		RenderThread::Invoke([]() { ImGui_ImplOpenGL3_Shutdown(); });
 		ImGui_ImplGlfw_Shutdown();
 		ImGui::DestroyContext();
 	}
@@ -226,7 +254,19 @@ namespace rebirth
 		io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		if (RenderThread::IsRunning())
+		{
+			ImguiDrawDataCopy* copy = new ImguiDrawDataCopy(ImGui::GetDrawData());
+			RenderThread::Submit([copy]()
+				{
+					ImGui_ImplOpenGL3_RenderDrawData(&copy->drawData);
+					delete copy;
+				});
+		}
+		else
+		{
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		}
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
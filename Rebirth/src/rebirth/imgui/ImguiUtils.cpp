@@ -167,6 +167,29 @@ namespace rebirth::UI
 		return ret;
 	}
 
+	bool DrawIntControl(const std::string& label, int* value, float step /*= 0.1f*/, int minValue /*= 0*/, int maxValue /*= 0*/)
+	{
+		bool ret = false;
+		if (ImGui::BeginTable(label.c_str(), 2))
+		{
+			ImGui::TableSetupColumn("col1", ImGuiTableColumnFlags_WidthFixed, gColumnWidth);
+			ImGui::TableNextColumn();
+			if (gAlignment == TextAlign_RIGHT)
+			{
+				auto posX = (ImGui::GetCursorPosX() + gColumnWidth - ImGui::CalcTextSize(label.c_str()).x
+					- ImGui::GetScrollX() - 2 * ImGui::GetStyle().ItemSpacing.x);
+				ImGui::SetCursorPosX(posX);
+			}
+			ImGui::TextUnformatted(label.c_str());
+			ImGui::TableNextColumn();
+			std::string temp = ReplaceAll(label, " ", "");
+			ret = ImGui::DragInt(fmt::format("##{}", temp).c_str(), value, step, minValue, maxValue);
+
+			ImGui::EndTable();
+		}
+		return ret;
+	}
+
 	void PushColumnWidth(float columnWidth)
 	{
 		gColumnWidth = columnWidth;
@@ -46,6 +46,7 @@ namespace rebirth::UI
 	void DrawTooltip(const char* desc);
 
 	bool DrawFloatControl(const std::string& label, float* value, float step = 0.01f, float minValue = -0.0f, float maxValue = 0.0f);
+	bool DrawIntControl(const std::string& label, int* value, float step = 0.1f, int minValue = 0, int maxValue = 0);
 
 	void Image(const Ref<Texture2D>& texture, const glm::vec2& size, glm::vec4 tintColor = { 1, 1, 1, 1 });
 	bool ImageButton(const Ref<Texture2D>& texture, const glm::vec2& size, glm::vec4 tintColor = { 1, 1, 1, 1 });
@@ -0,0 +1,170 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Batch.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "VertexArray.h"
+#include "Shader.h"
+#include "VertexLayout.h"
+
+namespace rebirth
+{
+	struct BatchStats
+	{
+		uint32 drawCalls = 0;
+		uint32 primitives = 0;
+	};
+
+	// Collects primitives of one vertex type and draws them in as few calls as it can.
+	// Policy supplies:
+	//   VERTICES      - vertices written per primitive
+	//   PER_INSTANCE  - whether the vertex buffer advances per instance
+	//   SelectShader(shader) - the shader to draw with, given the batch's own
+	//   Prepare()     - called before each draw, after the shader is bound
+	//   Draw(vertexArray, primitiveCount, firstVertex)
+	template<typename Vertex, typename Policy>
+	class Batch
+	{
+	public:
+		static constexpr uint32 STREAM_REGIONS = 3;
+
+		// Streaming batches write into a mapped buffer region, otherwise into CPU staging memory
+		// that grows as needed and is uploaded when the batch is drawn
+		void Init(uint32 maxPrimitives, const Ref<Shader>& shader, const Ref<IndexBuffer>& indexBuffer, bool streaming)
+		{
+			mMaxPrimitives = maxPrimitives;
+			mShader = shader;
+
+			uint32 size = maxPrimitives * Policy::VERTICES * sizeof(Vertex);
+			mBuffer = streaming ? VertexBuffer::CreateStreaming(size, STREAM_REGIONS) : VertexBuffer::Create(size);
+			mBuffer->SetLayout(MakeBufferLayout<Vertex>(Policy::PER_INSTANCE));
+
+			mVertexArray = VertexArray::Create();
+			mVertexArray->AddVertexBuffer(mBuffer);
+			if (indexBuffer)
+				mVertexArray->SetIndexBuffer(indexBuffer);
+
+			Reset();
+		}
+
+		void Shutdown()
+		{
+			mVertexArray = nullptr;
+			mBuffer = nullptr;
+			mShader = nullptr;
+			mStaging.clear();
+			mStaging.shrink_to_fit();
+			mBase = nullptr;
+			mCapacity = 0;
+			mCount = 0;
+		}
+
+		bool IsInitialized() const { return mBuffer != nullptr; }
+
+		// Room for count primitives. If they don't fit the batch is drawn and restarted first,
+		// so the pointer is only valid until the next Allocate
+		Vertex* Allocate(uint32 count = 1)
+		{
+			if (mCount + count > mCapacity)
+				MakeRoom(count);
+
+			Vertex* vertices = mBase + (size_t)mCount * Policy::VERTICES;
+			mCount += count;
+			mStats.primitives += count;
+			return vertices;
+		}
+
+		// Primitives that can still be allocated without drawing
+		uint32 GetRemaining() const { return mMaxPrimitives - mCount; }
+		uint32 GetCount() const { return mCount; }
+
+		void Flush()
+		{
+			if (!mCount)
+				return;
+
+			uint32 first = 0;
+			if (mBuffer->IsStreaming())
+				first = mBuffer->GetRegionOffset() / sizeof(Vertex);
+			else
+				mBuffer->SetData(mStaging.data(), mCount * Policy::VERTICES * sizeof(Vertex));
+
+			Policy::SelectShader(mShader)->Bind();
+			Policy::Prepare();
+			Policy::Draw(mVertexArray, mCount, first);
+			mStats.drawCalls++;
+		}
+
+		// Drops the written primitives, a streaming buffer moves on to its next region
+		void Reset()
+		{
+			mCount = 0;
+			if (!mBuffer)
+				return;
+
+			if (mBuffer->IsStreaming())
+			{
+				mBuffer->NextRegion();
+				mBase = (Vertex*)mBuffer->GetMappedRegion();
+				mCapacity = mMaxPrimitives;
+			}
+			else
+			{
+				mBase = mStaging.data();
+			}
+		}
+
+		const BatchStats& GetStats() const { return mStats; }
+		void ResetStats() { mStats = {}; }
+
+	private:
+		void MakeRoom(uint32 count)
+		{
+			RB_CORE_ASSERT(count <= mMaxPrimitives, "More primitives than fit in a batch");
+
+			if (mCount + count > mMaxPrimitives)
+			{
+				Flush();
+				Reset();
+			}
+
+			if (mCount + count > mCapacity)
+			{
+				mCapacity = std::min(mMaxPrimitives, std::max(mCount + count, mCapacity * 2));
+				mStaging.resize((size_t)mCapacity * Policy::VERTICES);
+				mBase = mStaging.data();
+			}
+		}
+
+		uint32 mMaxPrimitives = 0;
+		uint32 mCapacity = 0; // primitives mBase has room for
+		uint32 mCount = 0;
+		Vertex* mBase = nullptr;
+
+		std::vector<Vertex> mStaging;
+		Ref<VertexBuffer> mBuffer;
+		Ref<VertexArray> mVertexArray;
+		Ref<Shader> mShader;
+
+		BatchStats mStats;
+	};
+}
@@ -26,6 +26,7 @@
 
 #include "Renderer.h"
 #include "platform/opengl/OpenGLBuffer.h"
+#include "platform/null/NullBuffer.h"
 
 namespace rebirth
 {
@@ -41,6 +42,7 @@ namespace rebirth
 			}
 
 			case GraphicsAPI::API::OPENGL: return createRef<OpenGLVertexBuffer>(size);
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullVertexBuffer>(size);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
@@ -58,12 +60,30 @@ namespace rebirth
 		}
 
 		case GraphicsAPI::API::OPENGL: return createRef<OpenGLVertexBuffer>(size, vertices);
+		case GraphicsAPI::API::NULL_RECORDING: return createRef<NullVertexBuffer>(size, vertices);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
 		return nullptr;
 	}
 
+	Ref<VertexBuffer> VertexBuffer::CreateStreaming(const uint32 regionSize, const uint32 regionCount)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case GraphicsAPI::API::NONE:
+		{
+			RB_CORE_ASSERT(false, "Must use a graphics API");
+			return nullptr;
+		}
+
+		case GraphicsAPI::API::OPENGL: return createRef<OpenGLStreamingVertexBuffer>(regionSize, regionCount);
+		case GraphicsAPI::API::NULL_RECORDING: return createRef<NullStreamingVertexBuffer>(regionSize, regionCount);
+		}
+
+		RB_CORE_ASSERT(false, "Unknown graphics API");
+		return nullptr;
+	}
 
 
 	Ref<IndexBuffer> IndexBuffer::Create(const uint32 count, uint32* indices)
@@ -80,6 +100,11 @@ namespace rebirth
 		{
 			return createRef<OpenGLIndexBuffer>(count, indices);
 		}
+
+		case GraphicsAPI::API::NULL_RECORDING:
+		{
+			return createRef<NullIndexBuffer>(count, indices);
+		}
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
@@ -39,7 +39,15 @@ namespace rebirth
 		INT2,
 		INT3,
 		INT4,
-		BOOL
+		BOOL,
+
+		// Packed types, read by the shader as floats except for UINT16
+		UBYTE4_NORM,	// 4 unsigned bytes mapped to [0, 1], e.g. an RGBA8 color
+		HALF,			// 16 bit float
+		HALF2,
+		SHORT2_NORM,	// 2 signed shorts mapped to [-1, 1]
+		USHORT2_NORM,	// 2 unsigned shorts mapped to [0, 1]
+		UINT16			// read as a uint
 	};
 
 	static uint32 ShaderDataTypeSize(const ShaderDataType type)
@@ -57,6 +65,12 @@ namespace rebirth
 			case ShaderDataType::INT3: return 4 * 3;
 			case ShaderDataType::INT4: return 4 * 4;
 			case ShaderDataType::BOOL: return 1;
+			case ShaderDataType::UBYTE4_NORM: return 1 * 4;
+			case ShaderDataType::HALF: return 2;
+			case ShaderDataType::HALF2: return 2 * 2;
+			case ShaderDataType::SHORT2_NORM: return 2 * 2;
+			case ShaderDataType::USHORT2_NORM: return 2 * 2;
+			case ShaderDataType::UINT16: return 2;
 			case ShaderDataType::NONE:
 				RB_CORE_ASSERT(false, "Unknown shader data type");
 				return 0;
@@ -66,6 +80,12 @@ namespace rebirth
 		return 0;
 	}
 
+	// Integer data the shader should see as floats in [0, 1] or [-1, 1]
+	static bool ShaderDataTypeNormalized(const ShaderDataType type)
+	{
+		return type == ShaderDataType::UBYTE4_NORM || type == ShaderDataType::SHORT2_NORM || type == ShaderDataType::USHORT2_NORM;
+	}
+
 	struct BufferElement
 	{
 		std::string name;
@@ -76,8 +96,8 @@ namespace rebirth
 
 		BufferElement() = default;
 		
-		BufferElement(const ShaderDataType pType, const std::string& pName) :
-			name(pName), type(pType), size(ShaderDataTypeSize(pType)), offset(0), normalized(false) {}
+		BufferElement(const ShaderDataType pType, const std::string& pName, const bool pNormalized = false) :
+			name(pName), type(pType), size(ShaderDataTypeSize(pType)), offset(0), normalized(pNormalized || ShaderDataTypeNormalized(pType)) {}
 
 		uint32 GetComponentCount() const
 		{
@@ -94,6 +114,12 @@ namespace rebirth
 			case ShaderDataType::INT3: return 3;
 			case ShaderDataType::INT4: return 4;
 			case ShaderDataType::BOOL: return 1;
+			case ShaderDataType::UBYTE4_NORM: return 4;
+			case ShaderDataType::HALF: return 1;
+			case ShaderDataType::HALF2: return 2;
+			case ShaderDataType::SHORT2_NORM: return 2;
+			case ShaderDataType::USHORT2_NORM: return 2;
+			case ShaderDataType::UINT16: return 1;
 			case ShaderDataType::NONE:
 				{
 					RB_CORE_ASSERT(false, "Unknown shader data type");
@@ -111,7 +137,8 @@ namespace rebirth
 	{
 	public:
 		BufferLayout() = default;
-		BufferLayout(const std::initializer_list<BufferElement>& elements) : mElements(elements)
+		BufferLayout(const std::initializer_list<BufferElement>& elements, bool perInstance = false) :
+			mElements(elements), mPerInstance(perInstance)
 		{
 			CalculateOffsetsAndStride();
 		}
@@ -120,6 +147,9 @@ namespace rebirth
 
 		uint32 GetStride() const { return mStride; }
 
+		// Per instance layouts advance once per instance instead of once per vertex
+		bool IsPerInstance() const { return mPerInstance; }
+
 		
 		std::vector<BufferElement>::iterator begin() { return mElements.begin(); }
 		std::vector<BufferElement>::iterator end() { return mElements.end(); }
@@ -130,6 +160,7 @@ namespace rebirth
 	private:
 		std::vector<BufferElement> mElements;
 		uint32 mStride = 0;
+		bool mPerInstance = false;
 
 		void CalculateOffsetsAndStride()
 		{
@@ -158,8 +189,16 @@ namespace rebirth
 
 		virtual void SetData(const void* data, uint32 size) = 0;
 
+		// Streaming buffers stay mapped and are split into regions the GPU reads from in turn.
+		// Write straight into GetMappedRegion(), draw starting at GetRegionOffset() and then call NextRegion()
+		virtual bool IsStreaming() const { return false; }
+		virtual void* GetMappedRegion() { return nullptr; }
+		virtual uint32 GetRegionOffset() const { return 0; }
+		virtual void NextRegion() {}
+
 		static Ref<VertexBuffer> Create(uint32 size);
 		static Ref<VertexBuffer> Create(uint32 size, float* vertices);
+		static Ref<VertexBuffer> CreateStreaming(uint32 regionSize, uint32 regionCount = 3);
 	};
 
 	class IndexBuffer
@@ -0,0 +1,431 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: CookedTexture.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "CookedTexture.h"
+#include "ImageLoader.h"
+
+#include <stb_image.h>
+
+#include <fstream>
+#include <climits>
+
+namespace rebirth
+{
+	// "RBTX"
+	static constexpr uint32 sTextureMagic = 0x58544252;
+
+	// Levels of a texture are never more than this, 2^31 texels on a side
+	static constexpr uint32 sMaxLevels = 32;
+
+	struct TextureHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 format;
+		uint32 levelCount;
+	};
+
+	struct TextureLevel
+	{
+		uint32 width;
+		uint32 height;
+		uint32 offset;
+		uint32 size;
+	};
+
+	// The records are read straight out of the mapping
+	static_assert(sizeof(TextureHeader) % 4 == 0 && sizeof(TextureLevel) % 4 == 0, "Texture records must stay 4 byte aligned");
+
+	static uint16 To565(const int color[3])
+	{
+		return (uint16)(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) | (color[2] >> 3));
+	}
+
+	static void From565(const uint16 packed, int outColor[3])
+	{
+		int r = (packed >> 11) & 31;
+		int g = (packed >> 5) & 63;
+		int b = packed & 31;
+		outColor[0] = (r << 3) | (r >> 2);
+		outColor[1] = (g << 2) | (g >> 4);
+		outColor[2] = (b << 3) | (b >> 2);
+	}
+
+	// Endpoints are the corners of the block's bounding box, along the diagonal the colors actually follow.
+	// Each pixel then takes the nearest of the four palette entries
+	static void EncodeColorBlock(const byte block[16][4], byte* out)
+	{
+		int min[3] = { 255, 255, 255 };
+		int max[3] = { 0, 0, 0 };
+		int sum[3] = {};
+		for (uint32 i = 0; i < 16; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				min[c] = std::min(min[c], (int)block[i][c]);
+				max[c] = std::max(max[c], (int)block[i][c]);
+				sum[c] += block[i][c];
+			}
+		}
+
+		// The box diagonal goes up in every channel, flip the channels that fall as the widest one rises
+		int axis = 0;
+		for (int c = 1; c < 3; c++)
+		{
+			if (max[c] - min[c] > max[axis] - min[axis])
+				axis = c;
+		}
+
+		for (int c = 0; c < 3; c++)
+		{
+			if (c == axis)
+				continue;
+
+			int covariance = 0;
+			for (uint32 i = 0; i < 16; i++)
+				covariance += (block[i][c] * 16 - sum[c]) * (block[i][axis] * 16 - sum[axis]);
+
+			if (covariance < 0)
+				std::swap(min[c], max[c]);
+		}
+
+		// Pulling the endpoints in a little lowers the error of the colors between them
+		for (int c = 0; c < 3; c++)
+		{
+			int inset = (max[c] - min[c]) / 16;
+			max[c] -= inset;
+			min[c] += inset;
+		}
+
+		uint16 color0 = To565(max);
+		uint16 color1 = To565(min);
+		// Four color mode needs the first endpoint to be the larger one
+		if (color0 < color1)
+			std::swap(color0, color1);
+
+		uint32 indices = 0;
+		if (color0 != color1)
+		{
+			int palette[4][3];
+			From565(color0, palette[0]);
+			From565(color1, palette[1]);
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+
+			for (uint32 i = 0; i < 16; i++)
+			{
+				uint32 best = 0;
+				int bestDistance = INT_MAX;
+				for (uint32 p = 0; p < 4; p++)
+				{
+					int distance = 0;
+					for (int c = 0; c < 3; c++)
+					{
+						int delta = (int)block[i][c] - palette[p][c];
+						distance += delta * delta;
+					}
+
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						best = p;
+					}
+				}
+				indices |= best << (i * 2);
+			}
+		}
+
+		memcpy(out, &color0, sizeof(uint16));
+		memcpy(out + 2, &color1, sizeof(uint16));
+		memcpy(out + 4, &indices, sizeof(uint32));
+	}
+
+	// Endpoints are the block's alpha range, with the six values between them in eight alpha mode
+	static void EncodeAlphaBlock(const byte block[16][4], byte* out)
+	{
+		int alpha0 = 0;
+		int alpha1 = 255;
+		for (uint32 i = 0; i < 16; i++)
+		{
+			alpha0 = std::max(alpha0, (int)block[i][3]);
+			alpha1 = std::min(alpha1, (int)block[i][3]);
+		}
+
+		uint64 indices = 0;
+		if (alpha0 != alpha1)
+		{
+			int palette[8] = { alpha0, alpha1 };
+			for (int p = 1; p < 7; p++)
+				palette[p + 1] = ((7 - p) * alpha0 + p * alpha1) / 7;
+
+			for (uint32 i = 0; i < 16; i++)
+			{
+				uint64 best = 0;
+				int bestDistance = INT_MAX;
+				for (uint32 p = 0; p < 8; p++)
+				{
+					int distance = std::abs((int)block[i][3] - palette[p]);
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						best = p;
+					}
+				}
+				indices |= best << (i * 3);
+			}
+		}
+
+		out[0] = (byte)alpha0;
+		out[1] = (byte)alpha1;
+		for (int b = 0; b < 6; b++)
+			out[2 + b] = (byte)(indices >> (b * 8));
+	}
+
+	static void CompressLevel(const byte* pixels, const uint32 width, const uint32 height, const CookedTextureFormat format, byte* out)
+	{
+		const uint32 blocksX = (width + 3) / 4;
+		const uint32 blocksY = (height + 3) / 4;
+		for (uint32 by = 0; by < blocksY; by++)
+		{
+			for (uint32 bx = 0; bx < blocksX; bx++)
+			{
+				// Blocks hanging over the edge repeat the last row and column
+				byte block[16][4];
+				for (uint32 y = 0; y < 4; y++)
+				{
+					uint32 sy = std::min(by * 4 + y, height - 1);
+					for (uint32 x = 0; x < 4; x++)
+					{
+						uint32 sx = std::min(bx * 4 + x, width - 1);
+						memcpy(block[y * 4 + x], &pixels[((size_t)sy * width + sx) * 4], 4);
+					}
+				}
+
+				if (format == CookedTextureFormat::BC3)
+				{
+					EncodeAlphaBlock(block, out);
+					EncodeColorBlock(block, out + 8);
+					out += 16;
+				}
+				else
+				{
+					EncodeColorBlock(block, out);
+					out += 8;
+				}
+			}
+		}
+	}
+
+	// Box filter, averages each 2x2 of the level above. Odd edges repeat their last row or column
+	static std::vector<byte> MakeNextLevel(const std::vector<byte>& pixels, const uint32 width, const uint32 height, const uint32 nextWidth, const uint32 nextHeight)
+	{
+		std::vector<byte> next((size_t)nextWidth * nextHeight * 4);
+		for (uint32 y = 0; y < nextHeight; y++)
+		{
+			uint32 y0 = std::min(y * 2, height - 1);
+			uint32 y1 = std::min(y * 2 + 1, height - 1);
+			for (uint32 x = 0; x < nextWidth; x++)
+			{
+				uint32 x0 = std::min(x * 2, width - 1);
+				uint32 x1 = std::min(x * 2 + 1, width - 1);
+				for (uint32 c = 0; c < 4; c++)
+				{
+					uint32 total = pixels[((size_t)y0 * width + x0) * 4 + c] + pixels[((size_t)y0 * width + x1) * 4 + c]
+						+ pixels[((size_t)y1 * width + x0) * 4 + c] + pixels[((size_t)y1 * width + x1) * 4 + c];
+					next[((size_t)y * nextWidth + x) * 4 + c] = (byte)((total + 2) / 4);
+				}
+			}
+		}
+		return next;
+	}
+
+	bool CookedTexture::Cook(const std::string& source, const std::string& output, const bool compress)
+	{
+		RB_PROFILE_FUNC();
+
+		// Same orientation the runtime loaders give stb_image
+		stbi_set_flip_vertically_on_load_thread(1);
+		int width, height, channels;
+		byte* pixels = ImageLoader::Load(source, width, height, channels, 4);
+		if (!pixels)
+		{
+			RB_CORE_ERROR("Failed to load texture {}", source);
+			return false;
+		}
+
+		std::vector<byte> level(pixels, pixels + (size_t)width * height * 4);
+		ImageLoader::Free(pixels);
+
+		CookedTextureFormat format = CookedTextureFormat::RGBA8;
+		if (compress)
+		{
+			bool opaque = true;
+			for (size_t i = 3; i < level.size() && opaque; i += 4)
+				opaque = level[i] == 255;
+			format = opaque ? CookedTextureFormat::BC1 : CookedTextureFormat::BC3;
+		}
+
+		std::vector<TextureLevel> levels;
+		std::vector<byte> data;
+		uint32 levelWidth = (uint32)width;
+		uint32 levelHeight = (uint32)height;
+		while (true)
+		{
+			TextureLevel record = { levelWidth, levelHeight, (uint32)data.size(), GetLevelSize(format, levelWidth, levelHeight) };
+			data.resize(data.size() + record.size);
+			if (format == CookedTextureFormat::RGBA8)
+				memcpy(&data[record.offset], level.data(), record.size);
+			else
+				CompressLevel(level.data(), levelWidth, levelHeight, format, &data[record.offset]);
+			levels.push_back(record);
+
+			if (levelWidth == 1 && levelHeight == 1)
+				break;
+
+			uint32 nextWidth = std::max(1u, levelWidth / 2);
+			uint32 nextHeight = std::max(1u, levelHeight / 2);
+			level = MakeNextLevel(level, levelWidth, levelHeight, nextWidth, nextHeight);
+			levelWidth = nextWidth;
+			levelHeight = nextHeight;
+		}
+
+		const uint32 dataStart = (uint32)(sizeof(TextureHeader) + levels.size() * sizeof(TextureLevel));
+		for (auto& record : levels)
+			record.offset += dataStart;
+
+		TextureHeader header = { sTextureMagic, CookedTexture::VERSION, (uint32)format, (uint32)levels.size() };
+
+		std::ofstream out(output, std::ios::binary);
+		out.write((const char*)&header, sizeof(header));
+		out.write((const char*)levels.data(), levels.size() * sizeof(TextureLevel));
+		out.write((const char*)data.data(), data.size());
+		if (!out)
+		{
+			RB_CORE_ERROR("Failed to write cooked texture {}", output);
+			return false;
+		}
+
+		return true;
+	}
+
+	std::string CookedTexture::FindCooked(const std::string& source)
+	{
+		if (std::filesystem::path(source).extension() == EXTENSION)
+			return source;
+
+		std::string cooked = GetCookedPath(source);
+		if (Pack::Exists(cooked))
+			return cooked;
+
+		std::error_code error;
+		auto cookedTime = std::filesystem::last_write_time(cooked, error);
+		if (error)
+			return std::string();
+
+		// A source edited since the cook wins, a missing one means the cooked file is all there is
+		auto sourceTime = std::filesystem::last_write_time(source, error);
+		if (!error && sourceTime > cookedTime)
+			return std::string();
+
+		return cooked;
+	}
+
+	std::string CookedTexture::GetCookedPath(const std::string& source)
+	{
+		return source + EXTENSION;
+	}
+
+	uint32 CookedTexture::GetLevelSize(const CookedTextureFormat format, const uint32 width, const uint32 height)
+	{
+		switch (format)
+		{
+			case CookedTextureFormat::RGBA8: return width * height * 4;
+			case CookedTextureFormat::BC1: return ((width + 3) / 4) * ((height + 3) / 4) * 8;
+			case CookedTextureFormat::BC3: return ((width + 3) / 4) * ((height + 3) / 4) * 16;
+		}
+
+		RB_CORE_ASSERT(false, "Unknown cooked texture format");
+		return 0;
+	}
+
+	bool CookedTexture::Open(const std::string& filepath)
+	{
+		Close();
+		if (!Pack::Read(filepath, mView) && !mFile.Open(filepath))
+			return false;
+
+		const byte* fileData = mFile.IsOpen() ? mFile.GetData() : mView.GetData();
+		const uint64 fileSize = mFile.IsOpen() ? mFile.GetSize() : mView.GetSize();
+		const TextureHeader* header = fileSize >= sizeof(TextureHeader) ? (const TextureHeader*)fileData : nullptr;
+		if (!header || header->magic != sTextureMagic || header->version != CookedTexture::VERSION
+			|| header->format > (uint32)CookedTextureFormat::BC3 || header->levelCount == 0 || header->levelCount > sMaxLevels
+			|| fileSize < sizeof(TextureHeader) + (uint64)header->levelCount * sizeof(TextureLevel))
+		{
+			RB_CORE_WARN("{} is not a cooked texture of version {}", filepath, CookedTexture::VERSION);
+			Close();
+			return false;
+		}
+
+		mFormat = (CookedTextureFormat)header->format;
+		const TextureLevel* records = (const TextureLevel*)(fileData + sizeof(TextureHeader));
+		for (uint32 i = 0; i < header->levelCount; i++)
+		{
+			const TextureLevel& record = records[i];
+			bool valid = record.width && record.height && (uint64)record.offset + record.size <= fileSize
+				&& record.size == GetLevelSize(mFormat, record.width, record.height);
+
+			// Every level halves the one above it
+			if (valid && i > 0)
+				valid = record.width == std::max(1u, records[0].width >> i) && record.height == std::max(1u, records[0].height >> i);
+
+			if (!valid)
+			{
+				RB_CORE_WARN("Cooked texture {} is corrupt", filepath);
+				Close();
+				return false;
+			}
+
+			mLevels.push_back({ record.width, record.height, fileData + record.offset, record.size });
+		}
+
+		return true;
+	}
+
+	void CookedTexture::Close()
+	{
+		mFile.Close();
+		mView = PackView();
+		mLevels.clear();
+	}
+
+	uint64 CookedTexture::GetDataSize() const
+	{
+		uint64 size = 0;
+		for (const auto& level : mLevels)
+			size += level.size;
+		return size;
+	}
+}
@@ -0,0 +1,85 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: CookedTexture.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "rebirth/core/Pack.h"
+#include "rebirth/util/PlatformUtil.h"
+
+namespace rebirth
+{
+	enum class CookedTextureFormat : uint32
+	{
+		RGBA8 = 0,
+		BC1, // 4x4 blocks of 8 bytes, opaque
+		BC3  // 4x4 blocks of 16 bytes, BC1 color with interpolated alpha
+	};
+
+	// A texture cooked ahead of time into <source>.rbtex, with the full mip chain
+	// already generated and optionally block compressed. Layout: header, one record per level,
+	// then the level data those records point into. Offsets are from the start of the file.
+	// Opening maps the file, or finds it in a mounted pack, and the levels are uploaded straight out of the mapping
+	class CookedTexture
+	{
+	public:
+		static constexpr const char* EXTENSION = ".rbtex";
+		// Bump whenever a record changes, Rebirth-Cook recooks every texture then
+		static constexpr uint32 VERSION = 1;
+
+		struct Level
+		{
+			uint32 width;
+			uint32 height;
+			const byte* data;
+			uint32 size;
+		};
+
+		// Decodes the source, builds its mips and writes the .rbtex. Compressing picks BC1 for opaque images and BC3 for the rest
+		static bool Cook(const std::string& source, const std::string& output, bool compress = true);
+
+		// The .rbtex to load in place of the source, empty if it wasn't cooked or is older than the source
+		static std::string FindCooked(const std::string& source);
+		static std::string GetCookedPath(const std::string& source);
+
+		static uint32 GetLevelSize(CookedTextureFormat format, uint32 width, uint32 height);
+
+		// False if the file is missing, isn't a .rbtex of this version or a level is out of its bounds
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const { return !mLevels.empty(); }
+
+		CookedTextureFormat GetFormat() const { return mFormat; }
+		uint32 GetWidth() const { return mLevels.empty() ? 0 : mLevels[0].width; }
+		uint32 GetHeight() const { return mLevels.empty() ? 0 : mLevels[0].height; }
+		const std::vector<Level>& GetLevels() const { return mLevels; }
+
+		// Bytes of every level together, what the texture occupies once uploaded
+		uint64 GetDataSize() const;
+
+	private:
+		MappedFile mFile;
+		PackView mView;
+		CookedTextureFormat mFormat = CookedTextureFormat::RGBA8;
+		std::vector<Level> mLevels;
+	};
+}
@@ -25,6 +25,7 @@
 
 #include "Renderer.h"
 #include "platform/opengl/OpenGLFramebuffer.h"
+#include "platform/null/NullFramebuffer.h"
 
 namespace rebirth
 {
@@ -40,6 +41,7 @@ namespace rebirth
 			}
 
 			case GraphicsAPI::API::OPENGL: return createRef<OpenGLFramebuffer>(spec);
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullFramebuffer>(spec);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
@@ -0,0 +1,71 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Frustum.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "Frustum.h"
+
+namespace rebirth
+{
+
+	AABB AABB::FromQuad(const glm::mat4& transform)
+	{
+		// The quad's corners are +-0.5 along the x and y axes of the transform
+		glm::vec3 center = glm::vec3(transform[3]);
+		glm::vec3 extents = (glm::abs(glm::vec3(transform[0])) + glm::abs(glm::vec3(transform[1]))) * 0.5f;
+		return { center - extents, center + extents };
+	}
+
+	Frustum::Frustum(const glm::mat4& viewProjection)
+	{
+		// glm is column major, row i is (m[0][i], m[1][i], m[2][i], m[3][i])
+		glm::vec4 rows[4];
+		for (int i = 0; i < 4; i++)
+		{
+			rows[i] = { viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i] };
+		}
+
+		mPlanes[0] = rows[3] + rows[0];
+		mPlanes[1] = rows[3] - rows[0];
+		mPlanes[2] = rows[3] + rows[1];
+		mPlanes[3] = rows[3] - rows[1];
+		mPlanes[4] = rows[3] + rows[2];
+		mPlanes[5] = rows[3] - rows[2];
+	}
+
+	bool Frustum::Intersects(const AABB& box) const
+	{
+		glm::vec3 center = box.GetCenter();
+		glm::vec3 extents = box.GetExtents();
+
+		for (const auto& plane : mPlanes)
+		{
+			glm::vec3 normal = glm::vec3(plane);
+			float distance = glm::dot(normal, center) + plane.w;
+			float radius = glm::dot(glm::abs(normal), extents);
+			if (distance + radius < 0.0f)
+				return false;
+		}
+
+		return true;
+	}
+
+}
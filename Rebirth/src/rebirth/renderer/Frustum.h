@@ -0,0 +1,55 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Frustum.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace rebirth
+{
+	struct AABB
+	{
+		glm::vec3 min{ 0.0f };
+		glm::vec3 max{ 0.0f };
+
+		glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+		glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+		// World bounds of the unit quad (-0.5 to 0.5) Renderer2D draws with the given transform
+		static AABB FromQuad(const glm::mat4& transform);
+	};
+
+	// Planes are pulled straight out of the view projection, so it works for both
+	// orthographic and perspective cameras
+	class Frustum
+	{
+	public:
+		Frustum() = default;
+		explicit Frustum(const glm::mat4& viewProjection);
+
+		bool Intersects(const AABB& box) const;
+
+	private:
+		// xyz = normal pointing inwards, w = distance. Left, right, bottom, top, near, far
+		glm::vec4 mPlanes[6]{};
+	};
+}
@@ -25,8 +25,29 @@
 
 #include "GraphicsAPI.h"
 
+#include "platform/opengl/OpenGLGraphicsAPI.h"
+#include "platform/null/NullGraphicsAPI.h"
+
 namespace rebirth
 {
 	GraphicsAPI::API GraphicsAPI::sApi = GraphicsAPI::API::OPENGL;
+
+	Scope<GraphicsAPI> GraphicsAPI::Create()
+	{
+		switch (sApi)
+		{
+			case API::NONE:
+			{
+				RB_CORE_ASSERT(false, "Must use a graphics API");
+				return nullptr;
+			}
+
+			case API::OPENGL: return createScope<OpenGLGraphicsAPI>();
+			case API::NULL_RECORDING: return createScope<NullGraphicsAPI>();
+		}
+
+		RB_CORE_ASSERT(false, "Unknown graphics API");
+		return nullptr;
+	}
 }
 
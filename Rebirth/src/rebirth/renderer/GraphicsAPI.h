@@ -34,7 +34,8 @@ namespace rebirth
 		enum class API
 		{
 			NONE = 0,
-			OPENGL
+			OPENGL,
+			NULL_RECORDING
 		};
 
 		struct RenderCapabilities
@@ -44,6 +45,8 @@ namespace rebirth
 			std::string vendor;
 			int maxSamples;
 			float maxAniostropy;
+			bool persistentMapping = false; // VertexBuffer::CreateStreaming is usable
+			bool textureCompression = false; // BC1 and BC3 cooked textures can be loaded
 		};
 
 		virtual ~GraphicsAPI() = default;
@@ -54,13 +57,20 @@ namespace rebirth
 		virtual void SetClearColor(const glm::vec4& color) = 0;
 		virtual void Clear() = 0;
 
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 indexCount = 0) = 0;
-		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount) = 0;
+		// The offsets are added to every index/instance/vertex, used to draw from a region of a streaming buffer
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 indexCount = 0, uint32 vertexOffset = 0) = 0;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32 indexCount, uint32 instanceCount, uint32 instanceOffset = 0) = 0;
+		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount, uint32 vertexOffset = 0) = 0;
 
 		virtual void SetLineWidth(float width) = 0;
 
 		static API GetAPI() { return sApi;  }
 
+		// Must be called before Renderer::Init
+		static void SetAPI(API api) { sApi = api; }
+
+		static Scope<GraphicsAPI> Create();
+
 		static RenderCapabilities& GetCapabilities()
 		{
 			static RenderCapabilities capabilities;
@@ -0,0 +1,55 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: ImageLoader.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "ImageLoader.h"
+
+#include "rebirth/core/Pack.h"
+
+#include <stb_image.h>
+#include <climits>
+
+namespace rebirth
+{
+	byte* ImageLoader::Load(const std::string& path, int& width, int& height, int& channels, const int desiredChannels)
+	{
+		PackView view;
+		if (Pack::Read(path, view) && view.GetSize() <= INT_MAX)
+			return stbi_load_from_memory(view.GetData(), (int)view.GetSize(), &width, &height, &channels, desiredChannels);
+
+		return stbi_load(path.c_str(), &width, &height, &channels, desiredChannels);
+	}
+
+	bool ImageLoader::GetInfo(const std::string& path, int& width, int& height, int& channels)
+	{
+		PackView view;
+		if (Pack::Read(path, view) && view.GetSize() <= INT_MAX)
+			return stbi_info_from_memory(view.GetData(), (int)view.GetSize(), &width, &height, &channels);
+
+		return stbi_info(path.c_str(), &width, &height, &channels);
+	}
+
+	void ImageLoader::Free(byte* pixels)
+	{
+		stbi_image_free(pixels);
+	}
+}
@@ -0,0 +1,37 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: ImageLoader.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+namespace rebirth
+{
+	// stb_image decoding that reads from the mounted packs before the disk.
+	// Flipping follows whatever stbi_set_flip_vertically_on_load the caller set
+	class ImageLoader
+	{
+	public:
+		// Null if the image is missing or can't be decoded, free the pixels with Free
+		static byte* Load(const std::string& path, int& width, int& height, int& channels, int desiredChannels = 0);
+		static bool GetInfo(const std::string& path, int& width, int& height, int& channels);
+		static void Free(byte* pixels);
+	};
+}
@@ -25,11 +25,8 @@
 
 #include "RenderCommand.h"
 
-#include "platform/opengl/OpenGLGraphicsAPI.h"
-
 namespace rebirth
 {
-	// Temp
-	Scope<GraphicsAPI> RenderCommand::sRendererApi = createScope<OpenGLGraphicsAPI>();
+	Scope<GraphicsAPI> RenderCommand::sRendererApi = nullptr;
 
 }
\ No newline at end of file
@@ -32,6 +32,7 @@ namespace rebirth
 
 		inline static void Init()
 		{
+			sRendererApi = GraphicsAPI::Create();
 			sRendererApi->Init();
 		}
 
@@ -50,16 +51,22 @@ namespace rebirth
 			sRendererApi->Clear();
 		}
 
-		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 indexCount = 0)
+		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32 indexCount = 0, uint32 vertexOffset = 0)
 		{
 			vertexArray->Bind();
-			sRendererApi->DrawIndexed(vertexArray, indexCount);
+			sRendererApi->DrawIndexed(vertexArray, indexCount, vertexOffset);
 		}
 
-		inline static void DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount)
+		inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32 indexCount, uint32 instanceCount, uint32 instanceOffset = 0)
 		{
 			vertexArray->Bind();
-			sRendererApi->DrawLines(vertexArray, vertexCount);
+			sRendererApi->DrawIndexedInstanced(vertexArray, indexCount, instanceCount, instanceOffset);
+		}
+
+		inline static void DrawLines(const Ref<VertexArray>& vertexArray, uint32 vertexCount, uint32 vertexOffset = 0)
+		{
+			vertexArray->Bind();
+			sRendererApi->DrawLines(vertexArray, vertexCount, vertexOffset);
 		}
 
 		inline static void SetLineWidth(float width)
@@ -0,0 +1,94 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: RenderCommandQueue.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "RenderCommandQueue.h"
+
+namespace rebirth
+{
+
+	RenderCommandQueue::RenderCommandQueue(const uint32 blockSize) :
+		mBlockSize(AlignUp(blockSize))
+	{
+		mBlocks.push_back({ new byte[mBlockSize], mBlockSize, 0 });
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		RB_CORE_ASSERT(!mCommandCount, "Render command queue destroyed with commands that never ran");
+
+		for (auto& block : mBlocks)
+			delete[] block.data;
+	}
+
+	void* RenderCommandQueue::CopyPayload(const void* data, const uint32 size)
+	{
+		// Payloads get a header too so Execute can step over them
+		void* memory = Allocate(sizeof(Header) + AlignUp(size));
+		Header* header = new (memory) Header{ nullptr, AlignUp(size) };
+		memcpy(header + 1, data, size);
+		return header + 1;
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		RB_PROFILE_FUNC();
+
+		for (uint32 i = 0; i <= mBlock; i++)
+		{
+			Block& block = mBlocks[i];
+			uint32 offset = 0;
+			while (offset < block.used)
+			{
+				Header* header = reinterpret_cast<Header*>(block.data + offset);
+				if (header->execute)
+					header->execute(header + 1);
+				offset += sizeof(Header) + header->size;
+			}
+			block.used = 0;
+		}
+
+		mBlock = 0;
+		mCommandCount = 0;
+	}
+
+	void* RenderCommandQueue::Allocate(const uint32 size)
+	{
+		// Blocks from earlier frames are kept, a new one is only allocated the first time a frame needs it.
+		// Large payloads like texture data get a block of their own
+		while (mBlocks[mBlock].used + size > mBlocks[mBlock].capacity)
+		{
+			mBlock++;
+			if (mBlock == mBlocks.size())
+			{
+				uint32 capacity = std::max(mBlockSize, size);
+				mBlocks.push_back({ new byte[capacity], capacity, 0 });
+			}
+		}
+
+		Block& block = mBlocks[mBlock];
+		void* memory = block.data + block.used;
+		block.used += size;
+		return memory;
+	}
+
+}
@@ -0,0 +1,96 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: RenderCommandQueue.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+namespace rebirth
+{
+	// Records type erased commands into reusable blocks of memory. Nothing is allocated once the
+	// blocks have grown to the size of a frame, Execute runs everything in order and rewinds.
+	// Not thread safe, only one thread records into a queue at a time
+	class RenderCommandQueue
+	{
+	public:
+		static constexpr uint32 DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+		explicit RenderCommandQueue(uint32 blockSize = DEFAULT_BLOCK_SIZE);
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename Fn>
+		void Submit(Fn&& fn)
+		{
+			using Command = std::decay_t<Fn>;
+			static_assert(alignof(Command) <= ALIGNMENT, "Render command is over aligned");
+
+			auto execute = [](void* command)
+			{
+				Command* cmd = static_cast<Command*>(command);
+				(*cmd)();
+				cmd->~Command();
+			};
+
+			void* memory = Allocate(sizeof(Header) + AlignUp((uint32)sizeof(Command)));
+			Header* header = new (memory) Header{ execute, AlignUp((uint32)sizeof(Command)) };
+			new (header + 1) Command(std::forward<Fn>(fn));
+			mCommandCount++;
+		}
+
+		// Copies data into the queue, the copy lives until the queue is executed
+		void* CopyPayload(const void* data, uint32 size);
+
+		// Runs every command in submission order, then rewinds to the first block
+		void Execute();
+
+		uint32 GetCommandCount() const { return mCommandCount; }
+		uint32 GetBlockCount() const { return (uint32)mBlocks.size(); }
+
+	private:
+		static constexpr uint32 ALIGNMENT = 16;
+
+		using ExecuteFn = void(*)(void*);
+
+		struct alignas(ALIGNMENT) Header
+		{
+			ExecuteFn execute;
+			uint32 size; // of the command following the header, 0 marks a payload
+		};
+
+		struct Block
+		{
+			byte* data = nullptr;
+			uint32 capacity = 0;
+			uint32 used = 0;
+		};
+
+		static constexpr uint32 AlignUp(uint32 size) { return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+		void* Allocate(uint32 size);
+
+		std::vector<Block> mBlocks;
+		uint32 mBlock = 0;
+		uint32 mBlockSize;
+		uint32 mCommandCount = 0;
+	};
+}
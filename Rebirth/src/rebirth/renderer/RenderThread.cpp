@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: RenderThread.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "RenderThread.h"
+
+namespace rebirth
+{
+	RenderCommandQueue RenderThread::sQueues[2];
+	uint32 RenderThread::sSubmitIndex = 0;
+
+	GraphicsContext* RenderThread::sContext = nullptr;
+	std::thread RenderThread::sThread;
+	std::thread::id RenderThread::sThreadId;
+	std::thread::id RenderThread::sRecordingThreadId;
+	std::mutex RenderThread::sMutex;
+	std::mutex RenderThread::sInvokeMutex;
+	std::condition_variable RenderThread::sCondition;
+
+	RenderCommandQueue* RenderThread::sPendingFrame = nullptr;
+	const std::function<void()>* RenderThread::sPendingInvoke = nullptr;
+	bool RenderThread::sStopping = false;
+
+	std::atomic<bool> RenderThread::sRunning = false;
+
+	void RenderThread::Start(GraphicsContext* context)
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!sRunning, "Render thread is already running");
+
+		sContext = context;
+		sContext->ReleaseCurrent();
+
+		sStopping = false;
+		sSubmitIndex = 0;
+		sRecordingThreadId = std::this_thread::get_id();
+		sThread = std::thread(&RenderThread::ThreadMain);
+		sThreadId = sThread.get_id();
+		sRunning.store(true, std::memory_order_release);
+
+		RB_CORE_INFO("Render thread started");
+	}
+
+	void RenderThread::Stop()
+	{
+		RB_PROFILE_FUNC();
+		if (!sRunning)
+			return;
+
+		// Whatever was recorded since the last kick may still free resources, run it too
+		Kick();
+		Sync();
+
+		{
+			std::lock_guard lock(sMutex);
+			sStopping = true;
+		}
+		sCondition.notify_all();
+		sThread.join();
+
+		sRunning.store(false, std::memory_order_release);
+		sThreadId = {};
+		sRecordingThreadId = {};
+		sContext->MakeCurrent();
+		sContext = nullptr;
+		RB_CORE_INFO("Render thread stopped");
+	}
+
+	bool RenderThread::IsRenderThread()
+	{
+		return std::this_thread::get_id() == sThreadId;
+	}
+
+	bool RenderThread::IsRecordingThread()
+	{
+		return std::this_thread::get_id() == sRecordingThreadId;
+	}
+
+	const void* RenderThread::CopyPayload(const void* data, const uint32 size)
+	{
+		if (!ShouldRecord())
+			return data;
+
+		RB_CORE_ASSERT(IsRecordingThread(), "Payloads can only be recorded from the thread that started the render thread");
+		return sQueues[sSubmitIndex].CopyPayload(data, size);
+	}
+
+	void RenderThread::Invoke(const std::function<void()>& fn)
+	{
+		if (!ShouldRecord())
+		{
+			fn();
+			return;
+		}
+
+		RB_PROFILE_FUNC();
+		std::lock_guard invokeLock(sInvokeMutex);
+		std::unique_lock lock(sMutex);
+		sPendingInvoke = &fn;
+		sCondition.notify_all();
+		sCondition.wait(lock, [] { return !sPendingInvoke; });
+	}
+
+	void RenderThread::Kick()
+	{
+		if (!sRunning)
+			return;
+
+		RB_PROFILE_FUNC();
+		std::unique_lock lock(sMutex);
+		sCondition.wait(lock, [] { return !sPendingFrame; });
+
+		sPendingFrame = &sQueues[sSubmitIndex];
+		sSubmitIndex ^= 1;
+		sCondition.notify_all();
+	}
+
+	void RenderThread::Sync()
+	{
+		if (!sRunning)
+			return;
+
+		RB_PROFILE_FUNC();
+		std::unique_lock lock(sMutex);
+		sCondition.wait(lock, [] { return !sPendingFrame; });
+	}
+
+	void RenderThread::ThreadMain()
+	{
+		sContext->MakeCurrent();
+
+		std::unique_lock lock(sMutex);
+		while (true)
+		{
+			sCondition.wait(lock, [] { return sPendingFrame || sPendingInvoke || sStopping; });
+
+			// A kicked frame always finishes before an invoke, so invokes never see half of one
+			// and can safely replace resources that frame still refers to
+			if (sPendingFrame)
+			{
+				RenderCommandQueue* frame = sPendingFrame;
+				lock.unlock();
+				frame->Execute();
+				lock.lock();
+
+				sPendingFrame = nullptr;
+				sCondition.notify_all();
+			}
+			else if (sPendingInvoke)
+			{
+				const auto* invoke = sPendingInvoke;
+				lock.unlock();
+				(*invoke)();
+				lock.lock();
+
+				sPendingInvoke = nullptr;
+				sCondition.notify_all();
+			}
+			else
+			{
+				break;
+			}
+		}
+		lock.unlock();
+
+		sContext->ReleaseCurrent();
+	}
+
+}
@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: RenderThread.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "RenderCommandQueue.h"
+#include "GraphicsContext.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace rebirth
+{
+	// Optional thread that owns the graphics context and replays recorded frames.
+	// While it runs, the main thread records frame N + 1 into one queue as the render thread
+	// executes frame N from the other. Every graphics call goes through Submit or Invoke,
+	// when the thread isn't running both simply call the function right away
+	class RenderThread
+	{
+	public:
+		// Takes the context from the calling thread, which becomes the only thread allowed to record
+		static void Start(GraphicsContext* context);
+
+		// Runs whatever was recorded, joins the thread and hands the context back to the caller
+		static void Stop();
+
+		static bool IsRunning() { return sRunning.load(std::memory_order_acquire); }
+		static bool IsRenderThread();
+		// The thread that called Start, the only one that records
+		static bool IsRecordingThread();
+
+		// Records fn into the frame being built. Anything captured must stay valid until the frame
+		// executes, capture resources by value (ids, Refs) rather than through this
+		template<typename Fn>
+		static void Submit(Fn&& fn)
+		{
+			if (!ShouldRecord())
+			{
+				fn();
+				return;
+			}
+
+			RB_CORE_ASSERT(IsRecordingThread(), "Graphics commands can only be recorded from the thread that started the render thread");
+			sQueues[sSubmitIndex].Submit(std::forward<Fn>(fn));
+		}
+
+		// Copies data into the frame being built so a submitted command can read it later.
+		// Returns data itself when commands run immediately
+		static const void* CopyPayload(const void* data, uint32 size);
+
+		// Runs fn on the render thread once the frame in flight has finished and waits for it.
+		// For creating resources and reading data back, the current frame has not executed yet.
+		// Safe from any thread, concurrent callers take turns
+		static void Invoke(const std::function<void()>& fn);
+
+		// Ends the recorded frame and hands it to the render thread, waits if the previous one is still running
+		static void Kick();
+
+		// Waits until every kicked frame has executed
+		static void Sync();
+
+	private:
+		static bool ShouldRecord() { return IsRunning() && !IsRenderThread(); }
+		static void ThreadMain();
+
+		static RenderCommandQueue sQueues[2];
+		static uint32 sSubmitIndex;
+
+		static GraphicsContext* sContext;
+		static std::thread sThread;
+		static std::thread::id sThreadId;
+		static std::thread::id sRecordingThreadId;
+		static std::mutex sMutex;
+		// Held for a whole Invoke, there is only one pending invoke slot
+		static std::mutex sInvokeMutex;
+		static std::condition_variable sCondition;
+
+		// Guarded by sMutex
+		static RenderCommandQueue* sPendingFrame;
+		static const std::function<void()>* sPendingInvoke;
+		static bool sStopping;
+
+		static std::atomic<bool> sRunning;
+	};
+}
@@ -31,16 +31,18 @@ namespace rebirth
 {
 	Scope<Renderer::Data> Renderer::sData = createScope<Renderer::Data>();
 
-	void Renderer::Init()
+	void Renderer::Init(const bool instancedQuads)
 	{
 		RB_PROFILE_FUNC();
 		RenderCommand::Init();
-		Renderer2D::Init();
+		sData->transformUniformBuffer = UniformBuffer::Create(sizeof(TransformData), TRANSFORM_BINDING);
+		Renderer2D::Init(instancedQuads ? Renderer2D::QuadPipeline::INSTANCED : Renderer2D::QuadPipeline::VERTEX);
 	}
 
 	void Renderer::Shutdown()
 	{
 		Renderer2D::Shutdown();
+		sData->transformUniformBuffer = nullptr;
 	}
 
 	void Renderer::OnWindowResize(const uint32 width, const uint32 height)
@@ -60,9 +62,9 @@ namespace rebirth
 
 	void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform /*= glm::mat4(1.0f)*/)
 	{
+		TransformData data = { sData->viewProj, transform };
+		sData->transformUniformBuffer->SetData(&data, sizeof(TransformData));
 		shader->Bind();
-		shader->SetMat4("uViewProj", sData->viewProj);
-		shader->SetMat4("uModelTransform", transform);
 		vertexArray->Bind();
 		RenderCommand::DrawIndexed(vertexArray);
 	}
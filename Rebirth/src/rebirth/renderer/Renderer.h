@@ -28,6 +28,7 @@
 
 #include "OrthoCamera.h"
 #include "Shader.h"
+#include "UniformBuffer.h"
 
 namespace rebirth
 {
@@ -36,21 +37,33 @@ namespace rebirth
 	class Renderer
 	{
 	public:
-		static void Init();
+		static void Init(bool instancedQuads = false);
 		static void Shutdown();
 		static void OnWindowResize(uint32 width, uint32 height);
 
 		static void BeginScene(OrthoCamera& camera);
 		static void EndScene();
 
+		// The shader reads uViewProj and uModelTransform from the Transform uniform block at TRANSFORM_BINDING
 		static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
 
+		// Binding 0 is the Renderer2D camera block
+		static constexpr uint32 TRANSFORM_BINDING = 1;
+
 		static GraphicsAPI::API GetAPI() { return GraphicsAPI::GetAPI(); }
 
 	private:
+		// Matches the std140 layout of the Transform block
+		struct TransformData
+		{
+			glm::mat4 viewProj;
+			glm::mat4 modelTransform;
+		};
+
 		struct Data
 		{
 			glm::mat4 viewProj;
+			Ref<UniformBuffer> transformUniformBuffer;
 		};
 
 		static Scope<Data> sData;
@@ -26,74 +26,175 @@
 #include "Shader.h"
 #include "RenderCommand.h"
 #include "UniformBuffer.h"
+#include "Batch.h"
+#include "Frustum.h"
+#include "SortKey.h"
+#include "rebirth/core/JobSystem.h"
 
 namespace rebirth
 {
 
+	// 28 bytes, the plain float layout was 48
 	struct QuadVertex
 	{
 		glm::vec3 pos;
-		glm::vec4 color;
-		glm::vec2 texCoord;
-		float texIndex;
-		float tilingFactor;
+		PackedColor color;
+		UShort2Norm texCoord; // tiling is applied in the shader, so this stays in [0, 1]
+		uint16 texIndex;
+		Half tilingFactor;
 
 		// editor
 		int entityId = -1;
+
+		static constexpr auto Attributes()
+		{
+			return std::make_tuple(
+				Attribute(&QuadVertex::pos, "aPos"),
+				Attribute(&QuadVertex::color, "aColor"),
+				Attribute(&QuadVertex::texCoord, "aTexCoord"),
+				Attribute(&QuadVertex::texIndex, "aTexIndex"),
+				Attribute(&QuadVertex::tilingFactor, "aTilingFactor"),
+				Attribute(&QuadVertex::entityId, "aEntityID"));
+		}
 	};
 
+	// One per quad in the instanced pipeline, QuadInstanced.glsl expands it into the 4 corners
+	struct QuadInstance
+	{
+		glm::vec3 axisX; // the transform's first two columns, whole so rotations about x and y survive
+		glm::vec3 axisY;
+		glm::vec3 translation;
+		PackedColor color;
+		UShort2Norm texMin;
+		UShort2Norm texMax;
+		uint16 texIndex;
+		Half tilingFactor;
+
+		// editor
+		int entityId = -1;
+
+		static constexpr auto Attributes()
+		{
+			return std::make_tuple(
+				Attribute(&QuadInstance::axisX, "aAxisX"),
+				Attribute(&QuadInstance::axisY, "aAxisY"),
+				Attribute(&QuadInstance::translation, "aTranslation"),
+				Attribute(&QuadInstance::color, "aColor"),
+				Attribute(&QuadInstance::texMin, "aTexMin"),
+				Attribute(&QuadInstance::texMax, "aTexMax"),
+				Attribute(&QuadInstance::texIndex, "aTexIndex"),
+				Attribute(&QuadInstance::tilingFactor, "aTilingFactor"),
+				Attribute(&QuadInstance::entityId, "aEntityID"));
+		}
+	};
+
+	// 28 bytes, the plain float layout was 48
 	struct CircleVertex
 	{
 		glm::vec3 worldPos;
-		glm::vec3 localPos;
-		glm::vec4 color;
-		float thickness;
-		float fade;
+		Short2Norm localPos; // the corners are always +-1
+		PackedColor color;
+		Half thickness;
+		Half fade;
 
 		// editor
 		int entityId = -1;
+
+		static constexpr auto Attributes()
+		{
+			return std::make_tuple(
+				Attribute(&CircleVertex::worldPos, "aWorldPos"),
+				Attribute(&CircleVertex::localPos, "aLocalPos"),
+				Attribute(&CircleVertex::color, "aColor"),
+				Attribute(&CircleVertex::thickness, "aThickness"),
+				Attribute(&CircleVertex::fade, "aFade"),
+				Attribute(&CircleVertex::entityId, "aEntityID"));
+		}
 	};
 
 	struct LineVertex
 	{
 		glm::vec3 position;
-		glm::vec4 color;
+		PackedColor color;
 
 		// editor
 		int entityId = -1;
+
+		static constexpr auto Attributes()
+		{
+			return std::make_tuple(
+				Attribute(&LineVertex::position, "aPos"),
+				Attribute(&LineVertex::color, "aColor"),
+				Attribute(&LineVertex::entityId, "aEntityID"));
+		}
+	};
+
+	struct QuadPolicy
+	{
+		static constexpr uint32 VERTICES = 4;
+		static constexpr bool PER_INSTANCE = false;
+		static const Ref<Shader>& SelectShader(const Ref<Shader>& shader);
+		static void Prepare();
+		static void Draw(const Ref<VertexArray>& vertexArray, uint32 count, uint32 first) { RenderCommand::DrawIndexed(vertexArray, count * 6, first); }
+	};
+
+	struct QuadInstancePolicy
+	{
+		static constexpr uint32 VERTICES = 1;
+		static constexpr bool PER_INSTANCE = true;
+		static const Ref<Shader>& SelectShader(const Ref<Shader>& shader);
+		static void Prepare() { QuadPolicy::Prepare(); }
+		static void Draw(const Ref<VertexArray>& vertexArray, uint32 count, uint32 first) { RenderCommand::DrawIndexedInstanced(vertexArray, 6, count, first); }
+	};
+
+	struct CirclePolicy
+	{
+		static constexpr uint32 VERTICES = 4;
+		static constexpr bool PER_INSTANCE = false;
+		static const Ref<Shader>& SelectShader(const Ref<Shader>& shader) { return shader; }
+		static void Prepare() {}
+		static void Draw(const Ref<VertexArray>& vertexArray, uint32 count, uint32 first) { RenderCommand::DrawIndexed(vertexArray, count * 6, first); }
+	};
+
+	struct LinePolicy
+	{
+		static constexpr uint32 VERTICES = 2;
+		static constexpr bool PER_INSTANCE = false;
+		static const Ref<Shader>& SelectShader(const Ref<Shader>& shader) { return shader; }
+		static void Prepare();
+		static void Draw(const Ref<VertexArray>& vertexArray, uint32 count, uint32 first) { RenderCommand::DrawLines(vertexArray, count * 2, first); }
 	};
 
 	struct RenderData
 	{
 		static const uint32 MAX_QUADS = 10000;
-		static const uint32 MAX_VERTS = MAX_QUADS * 4;
+		static const uint32 MAX_LINES = 20000;
 		static const uint32 MAX_INDICES = MAX_QUADS * 6;
 		static const uint32 MAX_TEXTURE_SLOTS = 32;
 
-		Ref<VertexArray> quadVertexArray;
-		Ref<VertexBuffer> quadVertexBuffer;
-		Ref<Shader> quadShader;
-
-		Ref<VertexArray> circleVertexArray;
-		Ref<VertexBuffer> circleVertexBuffer;
-		Ref<Shader> circleShader;
-
-		Ref<VertexArray> lineVertexArray;
-		Ref<VertexBuffer> lineVertexBuffer;
-		Ref<Shader> lineShader;
+		// Quad shader variants by the texture slots they sample, see TEXTURE_SLOTS in Quad.glsl.
+		// 1 is untextured (slot 0 is white), 2 samples a single texture without the switch
+		static constexpr uint32 QUAD_VARIANT_SLOTS[] = { 1, 2, 8, MAX_TEXTURE_SLOTS };
+		static constexpr uint32 QUAD_VARIANTS = (uint32)std::size(QUAD_VARIANT_SLOTS);
 
+		// Below this many items a parallel submission is just done on the calling thread
+		static const uint32 PARALLEL_THRESHOLD = 2048;
+		static const uint32 PARALLEL_MIN_CHUNK = 1024;
 
-		uint32 quadIndexCount = 0;
-		QuadVertex* quadVertexBufferBase = nullptr;
-		QuadVertex* quadVertexBufferPtr = nullptr;
+		Renderer2D::QuadPipeline quadPipeline = Renderer2D::QuadPipeline::VERTEX;
 
-		uint32 circleIndexCount = 0;
-		CircleVertex* circleVertexBufferBase = nullptr;
-		CircleVertex* circleVertexBufferPtr = nullptr;
+		// Only the quad batch for the selected pipeline is initialized
+		Batch<QuadVertex, QuadPolicy> quads;
+		Batch<QuadInstance, QuadInstancePolicy> quadInstances;
+		Batch<CircleVertex, CirclePolicy> circles;
+		Batch<LineVertex, LinePolicy> lines;
 
-		uint32 lineVertexCount = 0;
-		LineVertex* lineVertexBufferBase = nullptr;
-		LineVertex* lineVertexBufferPtr = nullptr;
+		// Kept apart from the batches so static batches can use them with either pipeline.
+		// One per QUAD_VARIANT_SLOTS entry, the instanced ones only with that pipeline
+		std::array<Ref<Shader>, QUAD_VARIANTS> quadShaders;
+		std::array<Ref<Shader>, QUAD_VARIANTS> quadInstancedShaders;
+		Ref<IndexBuffer> quadIndexBuffer;
+		BatchStats staticStats;
 
 		float lineWidth = 2.0f;
 
@@ -103,9 +204,35 @@ namespace rebirth
 		std::array<Ref<Texture2D>, MAX_TEXTURE_SLOTS> textureSlots;
 		uint32 textureSlotIndex = 1; // we use 0 for our default white texture
 
+		// Consecutive quads usually share a texture, skip the slot scan for those
+		const Texture2D* lastTexture = nullptr;
+		float lastTextureIndex = 0.0f;
 
+		Scope<TextureAtlas> textureAtlas;
 
-		Renderer2D::Stats stats;
+		// Rebuilt in every BeginScene from the camera
+		Frustum frustum;
+		bool culling = true;
+		uint32 culledCount = 0;
+		uint32 submittedCount = 0;
+
+		// Per item transform and visibility from the cull pass, and the indices of the visible items
+		std::vector<glm::mat4> submitTransforms;
+		std::vector<uint8> submitVisible;
+		std::vector<uint32> submitOrder;
+
+		bool sorting = false;
+		std::vector<SortItem> sortItems;
+		std::vector<SortItem> sortScratch;
+
+		// The circles' share of the above while DrawRenderables merges them with the sprites
+		std::vector<glm::mat4> circleTransforms;
+		std::vector<uint32> circleOrder;
+		std::vector<SortItem> circleKeys;
+
+		// Texture index and coords per visible item, resolved serially before the vertices are built in parallel
+		std::vector<float> submitTextureIndices;
+		std::vector<const glm::vec2*> submitTexCoords;
 
 		struct CameraData
 		{
@@ -118,28 +245,285 @@ namespace rebirth
 
 	static RenderData sData;
 
+	struct Renderer2D::StaticBatch
+	{
+		struct Segment
+		{
+			Ref<VertexArray> vertexArray;
+			std::vector<Ref<Texture2D>> textures; // slot 0 is always the white texture
+			AABB bounds;
+			uint32 quadCount = 0;
+			std::vector<uint64> keys; // SortKey of each quad, ascending
+		};
+
+		std::vector<Segment> segments;
+	};
+
+	// The cheapest variant that still covers every bound slot
+	static uint32 GetQuadVariant(const uint32 slotCount)
+	{
+		for (uint32 i = 0; i < RenderData::QUAD_VARIANTS; i++)
+		{
+			if (slotCount <= RenderData::QUAD_VARIANT_SLOTS[i])
+				return i;
+		}
+		return RenderData::QUAD_VARIANTS - 1;
+	}
+
+	const Ref<Shader>& QuadPolicy::SelectShader(const Ref<Shader>& shader)
+	{
+		return sData.quadShaders[GetQuadVariant(sData.textureSlotIndex)];
+	}
+
+	const Ref<Shader>& QuadInstancePolicy::SelectShader(const Ref<Shader>& shader)
+	{
+		return sData.quadInstancedShaders[GetQuadVariant(sData.textureSlotIndex)];
+	}
+
+	void QuadPolicy::Prepare()
+	{
+		for (uint32 i = 0; i < sData.textureSlotIndex; i++)
+		{
+			sData.textureSlots[i]->Bind(i);
+		}
+	}
+
+	void LinePolicy::Prepare()
+	{
+		RenderCommand::SetLineWidth(sData.lineWidth);
+	}
+
+	static constexpr glm::vec2 sDefaultTexCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+	static void WriteQuad(QuadVertex* vertex, const glm::mat4& transform, const glm::vec4& color, const glm::vec2* texCoord, float texIndex, float tilingFactor, int entityId)
+	{
+		for (uint32 i = 0; i < 4; i++)
+		{
+			vertex->pos = transform * sData.quadVertexPos[i];
+			vertex->color = color;
+			vertex->texCoord = texCoord[i];
+			vertex->texIndex = (uint16)texIndex;
+			vertex->tilingFactor = tilingFactor;
+			vertex->entityId = entityId;
+			vertex++;
+		}
+	}
 
+	static void WriteInstance(QuadInstance* instance, const glm::mat4& transform, const glm::vec4& color, const glm::vec2* texCoord, float texIndex, float tilingFactor, int entityId)
+	{
+		instance->axisX = glm::vec3(transform[0]);
+		instance->axisY = glm::vec3(transform[1]);
+		instance->translation = glm::vec3(transform[3]);
+		instance->color = color;
+		instance->texMin = texCoord[0];
+		instance->texMax = texCoord[2];
+		instance->texIndex = (uint16)texIndex;
+		instance->tilingFactor = tilingFactor;
+		instance->entityId = entityId;
+	}
 
-	void Renderer2D::Init()
+	static void WriteCircle(CircleVertex* vertex, const glm::mat4& transform, const glm::vec4& color, float thickness, float fade, int entityId)
+	{
+		for (uint32 i = 0; i < 4; i++)
+		{
+			vertex->worldPos = transform * sData.quadVertexPos[i];
+			vertex->localPos = glm::vec2(sData.quadVertexPos[i]) * 2.0f;
+			vertex->color = color;
+			vertex->thickness = thickness;
+			vertex->fade = fade;
+			vertex->entityId = entityId;
+			vertex++;
+		}
+	}
+
+	// Returns false if the texture isn't bound yet and every slot is taken, the batch has to be flushed first
+	static bool FindOrAddTextureSlot(const Ref<Texture2D>& texture, float& outIndex)
+	{
+		if (texture.get() == sData.lastTexture)
+		{
+			outIndex = sData.lastTextureIndex;
+			return true;
+		}
+
+		float textureIndex = 0.0f;
+		for (uint32 i = 1; i < sData.textureSlotIndex; i++)
+		{
+			if (*sData.textureSlots[i].get() == *texture.get())
+			{
+				textureIndex = (float)i;
+				break;
+			}
+		}
+
+		if (textureIndex == 0.0f)
+		{
+			if (sData.textureSlotIndex >= RenderData::MAX_TEXTURE_SLOTS)
+				return false;
+
+			textureIndex = (float)sData.textureSlotIndex;
+			sData.textureSlots[sData.textureSlotIndex] = texture;
+			sData.textureSlotIndex++;
+		}
+
+		sData.lastTexture = texture.get();
+		sData.lastTextureIndex = textureIndex;
+		outIndex = textureIndex;
+		return true;
+	}
+
+	// Splits [0, count) into one contiguous chunk per job thread, the calling thread takes the last one.
+	// Each chunk writes to its own slice so the result doesn't depend on scheduling
+	template<typename Fn>
+	static void ParallelFor(const char* name, uint32 count, const Fn& fn)
+	{
+		uint32 threads = JobSystem::GetThreadCount();
+		if (count < RenderData::PARALLEL_THRESHOLD || threads == 1)
+		{
+			fn(0, count);
+			return;
+		}
+
+		uint32 chunkSize = std::max(RenderData::PARALLEL_MIN_CHUNK, (count + threads - 1) / threads);
+		JobSystem::ParallelFor(name, count, chunkSize, fn);
+	}
+
+	static bool IsVisible(const glm::mat4& transform)
+	{
+		return !sData.culling || sData.frustum.Intersects(AABB::FromQuad(transform));
+	}
+
+	// Copies every item's world transform and fills submitOrder with the ones inside the frustum
+	template<typename Item>
+	static void CullItems(const std::vector<Item>& items)
 	{
 		RB_PROFILE_FUNC();
 
-		// Quads
-		sData.quadVertexArray = VertexArray::Create();
-
-		sData.quadVertexBuffer = VertexBuffer::Create(sData.MAX_VERTS * sizeof(QuadVertex));
-		sData.quadVertexBuffer->SetLayout({
-				{ ShaderDataType::FLOAT3, "aPos" },
-				{ ShaderDataType::FLOAT4, "aColor" },
-				{ ShaderDataType::FLOAT2, "aTexCoord" },
-				{ ShaderDataType::FLOAT, "aTexIndex" },
-				{ ShaderDataType::FLOAT, "aTilingFactor" },
-				{ ShaderDataType::INT, "aEntityID" },
+		const uint32 count = (uint32)items.size();
+		auto& transforms = sData.submitTransforms;
+		auto& visible = sData.submitVisible;
+		transforms.resize(count);
+		visible.resize(count);
+
+		ParallelFor("Renderer2D::CullItems", count, [&](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; i++)
+				{
+					transforms[i] = *items[i].transform;
+					visible[i] = IsVisible(transforms[i]);
+				}
 			});
-		sData.quadVertexArray->AddVertexBuffer(sData.quadVertexBuffer);
 
-		sData.quadVertexBufferBase = new QuadVertex[sData.MAX_VERTS];
+		auto& order = sData.submitOrder;
+		order.clear();
+		for (uint32 i = 0; i < count; i++)
+		{
+			if (visible[i])
+				order.push_back(i);
+		}
+
+		sData.culledCount += count - (uint32)order.size();
+		sData.submittedCount += (uint32)order.size();
+	}
+
+	// Reorders submitOrder by key, equal keys keep their submission order
+	template<typename KeyFn>
+	static void SortSubmitOrder(const KeyFn& makeKey)
+	{
+		if (!sData.sorting)
+			return;
+
+		RB_PROFILE_FUNC();
+
+		auto& order = sData.submitOrder;
+		auto& items = sData.sortItems;
+		items.resize(order.size());
+		for (uint32 i = 0; i < (uint32)order.size(); i++)
+			items[i] = { makeKey(order[i]), order[i] };
+
+		SortKey::RadixSort(items, sData.sortScratch);
+
+		for (uint32 i = 0; i < (uint32)order.size(); i++)
+			order[i] = items[i].index;
+	}
+
+	enum SortShader : uint32
+	{
+		SORT_SHADER_QUAD = 0,
+		SORT_SHADER_CIRCLE = 1
+	};
+
+	// Keyed on the texture the quad will actually sample, so atlas sprites sort together
+	static uint64 MakeSpriteKey(const SpriteComponent& sprite, const glm::mat4& transform)
+	{
+		uint32 texture = 0;
+		if (sprite.subTexture && sprite.tilingFactor == 1.0f)
+			texture = sprite.subTexture->GetTexture()->GetId();
+		else if (sprite.texture)
+			texture = sprite.texture->GetId();
+		return SortKey::Make(sprite.layer, transform[3].z, SORT_SHADER_QUAD, texture);
+	}
 
+	// Where DrawSprites is in a static batch while merging its quads into the sorted sprites
+	struct StaticCursor
+	{
+		const Renderer2D::StaticBatch* batch = nullptr;
+		size_t segment = 0;
+		uint32 quad = 0;
+
+		bool HasNext() const { return batch && segment < batch->segments.size(); }
+		uint64 GetKey() const { return batch->segments[segment].keys[quad]; }
+	};
+
+	// Quads [begin, end) of a segment in one draw, a segment's vertices are 4 per quad in key order
+	static void DrawStaticQuads(const Renderer2D::StaticBatch::Segment& segment, const uint32 begin, const uint32 end)
+	{
+		const uint32 quads = end - begin;
+		if (sData.culling && !sData.frustum.Intersects(segment.bounds))
+		{
+			sData.culledCount += quads;
+			return;
+		}
+		sData.submittedCount += quads;
+
+		sData.quadShaders[GetQuadVariant((uint32)segment.textures.size())]->Bind();
+		for (uint32 i = 0; i < (uint32)segment.textures.size(); i++)
+		{
+			segment.textures[i]->Bind(i);
+		}
+
+		RenderCommand::DrawIndexed(segment.vertexArray, quads * 6, begin * 4);
+		sData.staticStats.drawCalls++;
+		sData.staticStats.primitives += quads;
+	}
+
+	// Draws the static quads keyed up to and including key, the batched quads have to be flushed before
+	static void DrawStaticQuadsUntil(StaticCursor& cursor, const uint64 key)
+	{
+		while (cursor.HasNext() && cursor.GetKey() <= key)
+		{
+			const auto& segment = cursor.batch->segments[cursor.segment];
+			uint32 end = (uint32)(std::upper_bound(segment.keys.begin() + cursor.quad, segment.keys.end(), key) - segment.keys.begin());
+			DrawStaticQuads(segment, cursor.quad, end);
+
+			cursor.quad = end;
+			if (cursor.quad == segment.quadCount)
+			{
+				cursor.segment++;
+				cursor.quad = 0;
+			}
+		}
+	}
+
+
+
+	void Renderer2D::Init(const QuadPipeline pipeline)
+	{
+		RB_PROFILE_FUNC();
+
+		sData.quadPipeline = pipeline;
+		const bool streaming = GraphicsAPI::GetCapabilities().persistentMapping;
+
+		// Shared by the vertex quads and circles
 		uint32* quadIndices = new uint32[sData.MAX_INDICES];
 
 		uint32 offset = 0;
@@ -157,44 +541,48 @@ namespace rebirth
 		}
 
 		Ref<IndexBuffer> sib = IndexBuffer::Create(sData.MAX_INDICES, quadIndices);
-		sData.quadVertexArray->SetIndexBuffer(sib);
 		delete[] quadIndices;
 
+		sData.quadIndexBuffer = sib;
 
-		// Circles
-		sData.circleVertexArray = VertexArray::Create();
-
-		sData.circleVertexBuffer = VertexBuffer::Create(sData.MAX_VERTS * sizeof(CircleVertex));
-		sData.circleVertexBuffer->SetLayout({
-				{ ShaderDataType::FLOAT3, "aWorldPos" },
-				{ ShaderDataType::FLOAT3, "aLocalPos" },
-				{ ShaderDataType::FLOAT4, "aColor" },
-				{ ShaderDataType::FLOAT, "aThickness" },
-				{ ShaderDataType::FLOAT, "aFade" },
-				{ ShaderDataType::INT, "aEntityID" },
-			});
-		sData.circleVertexArray->AddVertexBuffer(sData.circleVertexBuffer);
-		sData.circleVertexArray->SetIndexBuffer(sib);
-		sData.circleVertexBufferBase = new CircleVertex[sData.MAX_VERTS];
-
-
-		// Lines
-		sData.lineVertexArray = VertexArray::Create();
-
-		sData.lineVertexBuffer = VertexBuffer::Create(sData.MAX_VERTS * sizeof(LineVertex));
-		sData.lineVertexBuffer->SetLayout({
-				{ ShaderDataType::FLOAT3, "aPos" },
-				{ ShaderDataType::FLOAT4, "aColor" },
-				{ ShaderDataType::INT, "aEntityID" },
-			});
-		sData.lineVertexArray->AddVertexBuffer(sData.lineVertexBuffer);
-		sData.lineVertexBufferBase = new LineVertex[sData.MAX_VERTS];
+		// Compiled side by side, only linking happens here
+		ShaderLibrary shaders;
+		ShaderVariants quadVariants("assets/shaders/Quad.glsl");
+		ShaderVariants quadInstancedVariants("assets/shaders/QuadInstanced.glsl");
+		for (uint32 slots : RenderData::QUAD_VARIANT_SLOTS)
+		{
+			ShaderDefines defines = { { "TEXTURE_SLOTS", std::to_string(slots) } };
+			quadVariants.LoadAsync(defines);
+			if (pipeline == QuadPipeline::INSTANCED)
+				quadInstancedVariants.LoadAsync(defines);
+		}
+		shaders.LoadAsync("assets/shaders/Circle.glsl");
+		shaders.LoadAsync("assets/shaders/Line.glsl");
+		quadVariants.WaitForLoads();
+		quadInstancedVariants.WaitForLoads();
+		shaders.WaitForLoads();
 
+		for (uint32 i = 0; i < RenderData::QUAD_VARIANTS; i++)
+		{
+			ShaderDefines defines = { { "TEXTURE_SLOTS", std::to_string(RenderData::QUAD_VARIANT_SLOTS[i]) } };
+			sData.quadShaders[i] = quadVariants.Get(defines);
+			if (pipeline == QuadPipeline::INSTANCED)
+				sData.quadInstancedShaders[i] = quadInstancedVariants.Get(defines);
+		}
 
+		// Quads, the policies pick the variant when the batch is drawn
+		if (pipeline == QuadPipeline::INSTANCED)
+		{
+			uint32 instanceIndices[] = { 0, 1, 2, 2, 3, 0 };
+			sData.quadInstances.Init(sData.MAX_QUADS, sData.quadInstancedShaders.back(), IndexBuffer::Create(6, instanceIndices), streaming);
+		}
+		else
+		{
+			sData.quads.Init(sData.MAX_QUADS, sData.quadShaders.back(), sib, streaming);
+		}
 
-		sData.quadShader = Shader::Create("assets/shaders/Quad.glsl");
-		sData.circleShader = Shader::Create("assets/shaders/Circle.glsl");
-		sData.lineShader = Shader::Create("assets/shaders/Line.glsl");
+		sData.circles.Init(sData.MAX_QUADS, shaders.Get("Circle"), sib, streaming);
+		sData.lines.Init(sData.MAX_LINES, shaders.Get("Line"), nullptr, streaming);
 
 
 		sData.whiteTexture = Texture2D::Create(1, 1);
@@ -215,11 +603,23 @@ namespace rebirth
 		sData.quadVertexPos[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
 
 		sData.cameraUniformBuffer = UniformBuffer::Create(sizeof(RenderData::CameraData), 0);
+
+		sData.textureAtlas = createScope<TextureAtlas>();
 	}
 
 	void Renderer2D::Shutdown()
 	{
 		//RB_PROFILE_FUNC();
+		sData.textureAtlas.reset();
+
+		sData.quads.Shutdown();
+		sData.quadInstances.Shutdown();
+		sData.circles.Shutdown();
+		sData.lines.Shutdown();
+
+		sData.quadShaders = {};
+		sData.quadInstancedShaders = {};
+		sData.quadIndexBuffer = nullptr;
 	}
 
 	void Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform)
@@ -227,6 +627,7 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		sData.cameraBuffer.viewProjection = camera.GetProjection() * glm::inverse(transform);
 		sData.cameraUniformBuffer->SetData(&sData.cameraBuffer, sizeof(RenderData::CameraData));
+		sData.frustum = Frustum(sData.cameraBuffer.viewProjection);
 
 		StartBatch();
 	}
@@ -236,6 +637,7 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		sData.cameraBuffer.viewProjection = camera.ViewProjectionMatrix();
 		sData.cameraUniformBuffer->SetData(&sData.cameraBuffer, sizeof(RenderData::CameraData));
+		sData.frustum = Frustum(sData.cameraBuffer.viewProjection);
 
 		StartBatch();
 	}
@@ -245,6 +647,7 @@ namespace rebirth
 		RB_PROFILE_FUNC();
 		sData.cameraBuffer.viewProjection = camera.GetViewProjection();
 		sData.cameraUniformBuffer->SetData(&sData.cameraBuffer, sizeof(RenderData::CameraData));
+		sData.frustum = Frustum(sData.cameraBuffer.viewProjection);
 
 		StartBatch();
 	}
@@ -260,55 +663,26 @@ namespace rebirth
 	void Renderer2D::Flush()
 	{
 		RB_PROFILE_FUNC();
-		if (sData.quadIndexCount)
-		{
-			uint32 size = (uint32)((uint8_t*)sData.quadVertexBufferPtr - (uint8_t*)sData.quadVertexBufferBase);
-			sData.quadVertexBuffer->SetData(sData.quadVertexBufferBase, size);
-
-			for (uint32 i = 0; i < sData.textureSlotIndex; i++)
-			{
-				sData.textureSlots[i]->Bind(i);
-			}
-			sData.quadShader->Bind();
-			RenderCommand::DrawIndexed(sData.quadVertexArray, sData.quadIndexCount);
-			sData.stats.drawCalls++;
-		}
-
-		if (sData.circleIndexCount)
-		{
-			uint32 size = (uint32)((uint8_t*)sData.circleVertexBufferPtr - (uint8_t*)sData.circleVertexBufferBase);
-			sData.circleVertexBuffer->SetData(sData.circleVertexBufferBase, size);
-
-			sData.circleShader->Bind();
-			RenderCommand::DrawIndexed(sData.circleVertexArray, sData.circleIndexCount);
-			sData.stats.drawCalls++;
-		}
-
-		if (sData.lineVertexCount)
-		{
-			uint32 size = (uint32)((uint8_t*)sData.lineVertexBufferPtr - (uint8_t*)sData.lineVertexBufferBase);
-			sData.lineVertexBuffer->SetData(sData.lineVertexBufferBase, size);
-
-			sData.lineShader->Bind();
-			RenderCommand::SetLineWidth(sData.lineWidth);
-			RenderCommand::DrawLines(sData.lineVertexArray, sData.lineVertexCount);
-			sData.stats.drawCalls++;
-		}
+		sData.quads.Flush();
+		sData.quadInstances.Flush();
+		sData.circles.Flush();
+		sData.lines.Flush();
+	}
 
+	Renderer2D::QuadPipeline Renderer2D::GetQuadPipeline()
+	{
+		return sData.quadPipeline;
 	}
 
 	void Renderer2D::StartBatch()
 	{
-		sData.quadIndexCount = 0;
-		sData.quadVertexBufferPtr = sData.quadVertexBufferBase;
-
-		sData.circleIndexCount = 0;
-		sData.circleVertexBufferPtr = sData.circleVertexBufferBase;
-
-		sData.lineVertexCount = 0;
-		sData.lineVertexBufferPtr = sData.lineVertexBufferBase;
+		sData.quads.Reset();
+		sData.quadInstances.Reset();
+		sData.circles.Reset();
+		sData.lines.Reset();
 
 		sData.textureSlotIndex = 1;
+		sData.lastTexture = nullptr;
 	}
 
 	void Renderer2D::ResetBatch()
@@ -320,40 +694,19 @@ namespace rebirth
 
 	void Renderer2D::CreateQuad(const glm::mat4& transform, const glm::vec4 color, const glm::vec2* texCoord, float texIndex, float tilingFactor, int entityId)
 	{
-		constexpr size_t quadVertexCount = 4;
-		for (size_t i = 0; i < quadVertexCount; i++)
-		{
-			sData.quadVertexBufferPtr->pos = transform * sData.quadVertexPos[i];
-			sData.quadVertexBufferPtr->color = color;
-			sData.quadVertexBufferPtr->texCoord = texCoord[i];
-			sData.quadVertexBufferPtr->texIndex = texIndex;
-			sData.quadVertexBufferPtr->tilingFactor = tilingFactor;
-			sData.quadVertexBufferPtr->entityId = entityId;
-			sData.quadVertexBufferPtr++;
-		}
-
-
-		sData.quadIndexCount += 6;
-		sData.stats.quads++;
+		if (sData.quadPipeline == QuadPipeline::INSTANCED)
+			WriteInstance(sData.quadInstances.Allocate(), transform, color, texCoord, texIndex, tilingFactor, entityId);
+		else
+			WriteQuad(sData.quads.Allocate(), transform, color, texCoord, texIndex, tilingFactor, entityId);
 	}
 
 	float Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture)
 	{
 		float textureIndex = 0.0f;
-		for (uint32 i = 1; i < sData.textureSlotIndex; i++)
+		if (!FindOrAddTextureSlot(texture, textureIndex))
 		{
-			if (*sData.textureSlots[i].get() == *texture.get())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0.0f)
-		{
-			textureIndex = (float)sData.textureSlotIndex;
-			sData.textureSlots[sData.textureSlotIndex] = texture;
-			sData.textureSlotIndex++;
+			ResetBatch();
+			FindOrAddTextureSlot(texture, textureIndex);
 		}
 
 		return textureIndex;
@@ -365,11 +718,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		if (sData.quadIndexCount >= RenderData::MAX_INDICES)
-		{
-			ResetBatch();
-		}
-
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
 
 		CreateQuad(transform, color, textureCoords, 0, 1.0f, entityId);
@@ -381,11 +729,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		if (sData.quadIndexCount >= RenderData::MAX_INDICES)
-		{
-			ResetBatch();
-		}
-
 		float textureIndex = GetTextureIndex(texture);
 
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
@@ -399,11 +742,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		if (sData.quadIndexCount >= RenderData::MAX_INDICES)
-		{
-			ResetBatch();
-		}
-
 		float textureIndex = GetTextureIndex(subtexture->GetTexture());
 
 		const glm::vec2* textureCoords = subtexture->GetTexCoords();
@@ -473,11 +811,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		if (sData.quadIndexCount >= RenderData::MAX_INDICES)
-		{
-			ResetBatch();
-		}
-
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
 
 		glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos)
@@ -496,11 +829,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		if (sData.quadIndexCount >= RenderData::MAX_INDICES)
-		{
-			ResetBatch();
-		}
-
 		float textureIndex = GetTextureIndex(texture);
 
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
@@ -521,12 +849,6 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		if (sData.quadIndexCount >= RenderData::MAX_INDICES)
-		{
-			ResetBatch();
-		}
-
-
 		float textureIndex = GetTextureIndex(subtexture->GetTexture());
 
 		const glm::vec2* textureCoords = subtexture->GetTexCoords();
@@ -540,7 +862,17 @@ namespace rebirth
 
 	void Renderer2D::DrawSprite(const glm::mat4& transform, SpriteComponent& spriteComponent, int entityId)
 	{
-		if (spriteComponent.texture)
+		if (!IsVisible(transform))
+		{
+			sData.culledCount++;
+			return;
+		}
+		sData.submittedCount++;
+
+		// Atlas regions can't repeat, tiled sprites keep using their own texture
+		if (spriteComponent.subTexture && spriteComponent.tilingFactor == 1.0f)
+			DrawQuad(transform, spriteComponent.subTexture, 1.0f, spriteComponent.color, entityId);
+		else if (spriteComponent.texture)
 			DrawQuad(transform, spriteComponent.texture, spriteComponent.tilingFactor, spriteComponent.color, entityId);
 		else
 			DrawQuad(transform, spriteComponent.color, entityId);
@@ -550,37 +882,321 @@ namespace rebirth
 	{
 		RB_PROFILE_FUNC();
 
-		// #TODO Resetting batch for circles
+		if (!IsVisible(transform))
+		{
+			sData.culledCount++;
+			return;
+		}
+		sData.submittedCount++;
+
+		WriteCircle(sData.circles.Allocate(), transform, color, thickness, fade, entityId);
+	}
 
-		for (size_t i = 0; i < 4; i++)
+	void Renderer2D::DrawSprites(const std::vector<SpriteDrawItem>& sprites, const Ref<StaticBatch>& staticBatch)
+	{
+		DrawRenderables(sprites, {}, staticBatch);
+	}
+
+	void Renderer2D::DrawCircles(const std::vector<CircleDrawItem>& circles)
+	{
+		DrawRenderables({}, circles);
+	}
+
+	void Renderer2D::DrawRenderables(const std::vector<SpriteDrawItem>& sprites, const std::vector<CircleDrawItem>& circles, const Ref<StaticBatch>& staticBatch)
+	{
+		RB_PROFILE_FUNC();
+
+		// Without sorting there's no order to merge into, the static quads simply go under the sprites
+		const bool merge = sData.sorting;
+		StaticCursor statics;
+		if (!merge)
+			DrawStaticBatch(staticBatch);
+		else
+			statics.batch = staticBatch.get();
+
+		// Circles are culled and sorted first and moved aside, the sprites then use the submit buffers
+		CullItems(circles);
+		SortSubmitOrder([&](uint32 index)
+			{
+				return SortKey::Make(circles[index].circle->layer, sData.submitTransforms[index][3].z, SORT_SHADER_CIRCLE, 0);
+			});
+		std::swap(sData.submitOrder, sData.circleOrder);
+		std::swap(sData.submitTransforms, sData.circleTransforms);
+		std::swap(sData.sortItems, sData.circleKeys);
+
+		CullItems(sprites);
+		const auto& order = sData.submitOrder;
+		const auto& transforms = sData.submitTransforms;
+		const auto& keys = sData.sortItems; // Lines up with order when sorting
+
+		SortSubmitOrder([&](uint32 index)
+			{
+				return MakeSpriteKey(*sprites[index].sprite, transforms[index]);
+			});
+
+		const auto& circleOrder = sData.circleOrder;
+		const auto& circleTransforms = sData.circleTransforms;
+		const auto& circleKeys = sData.circleKeys; // Lines up with circleOrder when sorting
+
+		const uint32 count = (uint32)order.size();
+		const uint32 circleCount = (uint32)circleOrder.size();
+		auto& textureIndices = sData.submitTextureIndices;
+		auto& texCoords = sData.submitTexCoords;
+		textureIndices.resize(count);
+		texCoords.resize(count);
+
+		const bool instanced = sData.quadPipeline == QuadPipeline::INSTANCED;
+
+		uint32 first = 0;
+		uint32 circleFirst = 0;
+		auto nextSpriteKey = [&]() { return first < count ? keys[first].key : UINT64_MAX; };
+		auto nextCircleKey = [&]() { return circleFirst < circleCount ? circleKeys[circleFirst].key : UINT64_MAX; };
+
+		// Quads and circles are separate batches, each flush draws the quads first. So the open batch is
+		// flushed whenever the primitive changes, or it would draw them out of order
+		auto flushQuads = [&]() { if (sData.quads.GetCount() || sData.quadInstances.GetCount()) ResetBatch(); };
+		auto flushCircles = [&]() { if (sData.circles.GetCount()) ResetBatch(); };
+
+		bool slotsFull = false;
+		while (first < count || circleFirst < circleCount || statics.HasNext())
+		{
+			// Static quads that sort before the next sprite or circle are drawn first, equal keys included
+			if (statics.HasNext() && statics.GetKey() <= std::min(nextSpriteKey(), nextCircleKey()))
+			{
+				flushQuads();
+				flushCircles();
+				DrawStaticQuadsUntil(statics, std::min(nextSpriteKey(), nextCircleKey()));
+				slotsFull = false;
+				continue;
+			}
+
+			// Unsorted circles simply go over the sprites
+			if (circleFirst < circleCount && (first == count || (merge && nextCircleKey() < nextSpriteKey())))
+			{
+				flushQuads();
+				slotsFull = false;
+
+				uint32 capacity = sData.circles.GetRemaining();
+				if (!capacity)
+					capacity = RenderData::MAX_QUADS;
+
+				uint32 last = std::min(circleCount, circleFirst + capacity);
+				if (merge)
+				{
+					const uint64 end = std::min(nextSpriteKey(), statics.HasNext() ? statics.GetKey() : UINT64_MAX);
+					last = (uint32)(std::lower_bound(circleKeys.begin() + circleFirst, circleKeys.begin() + last, end,
+						[](const SortItem& item, uint64 key) { return item.key < key; }) - circleKeys.begin());
+				}
+
+				CircleVertex* vertices = sData.circles.Allocate(last - circleFirst);
+				ParallelFor("Renderer2D::WriteCircles", last - circleFirst, [&](uint32 begin, uint32 end)
+					{
+						for (uint32 i = begin; i < end; i++)
+						{
+							const uint32 index = circleOrder[circleFirst + i];
+							const auto& item = circles[index];
+							const auto& circle = *item.circle;
+							WriteCircle(vertices + i * 4, circleTransforms[index], circle.color, circle.thickness, circle.fade, item.entityId);
+						}
+					});
+
+				circleFirst = last;
+				continue;
+			}
+
+			flushCircles();
+			if (slotsFull)
+			{
+				ResetBatch();
+				slotsFull = false;
+			}
+
+			// A full batch is drawn and restarted by Allocate, texture slots carry over
+			uint32 capacity = instanced ? sData.quadInstances.GetRemaining() : sData.quads.GetRemaining();
+			if (!capacity)
+				capacity = RenderData::MAX_QUADS;
+
+			// Texture slots are handed out in submission order, same as DrawSprite would. The segment ends
+			// early if a texture needs a slot and none are left, or at the next static quad or circle
+			uint32 last = first;
+			bool reachedOther = false;
+			for (; last < count && last - first < capacity; last++)
+			{
+				if ((statics.HasNext() && keys[last].key >= statics.GetKey()) || (merge && keys[last].key > nextCircleKey()))
+				{
+					reachedOther = true;
+					break;
+				}
+
+				const auto& sprite = *sprites[order[last]].sprite;
+				texCoords[last] = sDefaultTexCoords;
+				textureIndices[last] = 0.0f;
+
+				if (sprite.subTexture && sprite.tilingFactor == 1.0f)
+				{
+					if (!FindOrAddTextureSlot(sprite.subTexture->GetTexture(), textureIndices[last]))
+						break;
+					texCoords[last] = sprite.subTexture->GetTexCoords();
+				}
+				else if (sprite.texture && !FindOrAddTextureSlot(sprite.texture, textureIndices[last]))
+				{
+					break;
+				}
+			}
+			slotsFull = !reachedOther && last < count && last - first < capacity;
+
+			uint32 quads = last - first;
+			QuadVertex* vertices = instanced ? nullptr : sData.quads.Allocate(quads);
+			QuadInstance* instances = instanced ? sData.quadInstances.Allocate(quads) : nullptr;
+			ParallelFor("Renderer2D::WriteQuads", quads, [&](uint32 begin, uint32 end)
+				{
+					for (uint32 i = begin; i < end; i++)
+					{
+						const uint32 index = order[first + i];
+						const auto& item = sprites[index];
+						const auto& sprite = *item.sprite;
+						float tilingFactor = sprite.texture ? sprite.tilingFactor : 1.0f;
+						if (instanced)
+							WriteInstance(instances + i, transforms[index], sprite.color, texCoords[first + i], textureIndices[first + i], tilingFactor, item.entityId);
+						else
+							WriteQuad(vertices + i * 4, transforms[index], sprite.color, texCoords[first + i], textureIndices[first + i], tilingFactor, item.entityId);
+					}
+				});
+
+			first = last;
+		}
+	}
+
+	// Same lookup as FindOrAddTextureSlot but into a static segment's own slots. Compares the textures themselves
+	// rather than their ids, streaming textures all report the default texture's id until they load
+	static bool FindOrAddStaticSlot(std::vector<Ref<Texture2D>>& textures, const Ref<Texture2D>& texture, float& outIndex)
+	{
+		for (uint32 i = 1; i < (uint32)textures.size(); i++)
 		{
-			sData.circleVertexBufferPtr->worldPos = transform * sData.quadVertexPos[i];
-			sData.circleVertexBufferPtr->localPos = sData.quadVertexPos[i] * 2.0f;
-			sData.circleVertexBufferPtr->color = color;
-			sData.circleVertexBufferPtr->thickness = thickness;
-			sData.circleVertexBufferPtr->fade = fade;
-			sData.circleVertexBufferPtr->entityId = entityId;
-			sData.circleVertexBufferPtr++;
+			if (textures[i] == texture)
+			{
+				outIndex = (float)i;
+				return true;
+			}
 		}
 
+		if (textures.size() >= RenderData::MAX_TEXTURE_SLOTS)
+			return false;
 
-		sData.circleIndexCount += 6;
-		sData.stats.quads++;
+		outIndex = (float)textures.size();
+		textures.push_back(texture);
+		return true;
+	}
+
+	// Uploads the vertices written so far and starts the next segment
+	static void FinishStaticSegment(Renderer2D::StaticBatch& batch, Renderer2D::StaticBatch::Segment& segment, std::vector<QuadVertex>& vertices)
+	{
+		if (segment.quadCount)
+		{
+			Ref<VertexBuffer> buffer = VertexBuffer::Create((uint32)(vertices.size() * sizeof(QuadVertex)), (float*)vertices.data());
+			buffer->SetLayout(MakeBufferLayout<QuadVertex>());
+
+			segment.vertexArray = VertexArray::Create();
+			segment.vertexArray->AddVertexBuffer(buffer);
+			segment.vertexArray->SetIndexBuffer(sData.quadIndexBuffer);
+			batch.segments.push_back(std::move(segment));
+		}
+
+		segment = {};
+		segment.textures.push_back(sData.whiteTexture);
+		vertices.clear();
+	}
+
+	Ref<Renderer2D::StaticBatch> Renderer2D::BuildStaticBatch(const std::vector<SpriteDrawItem>& sprites)
+	{
+		RB_PROFILE_FUNC();
+
+		// Always in key order, whether or not sorting is on, so quads sharing a layer, depth and texture end up together
+		std::vector<SortItem> order(sprites.size());
+		std::vector<SortItem> scratch;
+		for (uint32 i = 0; i < (uint32)sprites.size(); i++)
+			order[i] = { MakeSpriteKey(*sprites[i].sprite, *sprites[i].transform), i };
+		SortKey::RadixSort(order, scratch);
+
+		Ref<StaticBatch> batch = createRef<StaticBatch>();
+		StaticBatch::Segment segment;
+		std::vector<QuadVertex> vertices;
+		vertices.reserve(std::min((size_t)RenderData::MAX_QUADS, sprites.size()) * 4);
+		FinishStaticSegment(*batch, segment, vertices);
+
+		for (const auto& [key, index] : order)
+		{
+			const auto& item = sprites[index];
+			const auto& sprite = *item.sprite;
+			Ref<Texture2D> texture;
+			const glm::vec2* texCoords = sDefaultTexCoords;
+			if (sprite.subTexture && sprite.tilingFactor == 1.0f)
+			{
+				texture = sprite.subTexture->GetTexture();
+				texCoords = sprite.subTexture->GetTexCoords();
+			}
+			else
+			{
+				texture = sprite.texture;
+			}
+
+			float textureIndex = 0.0f;
+			if (segment.quadCount == RenderData::MAX_QUADS || (texture && !FindOrAddStaticSlot(segment.textures, texture, textureIndex)))
+			{
+				FinishStaticSegment(*batch, segment, vertices);
+				if (texture)
+					FindOrAddStaticSlot(segment.textures, texture, textureIndex);
+			}
+
+			const glm::mat4& transform = *item.transform;
+			const AABB bounds = AABB::FromQuad(transform);
+			if (segment.quadCount)
+			{
+				segment.bounds.min = glm::min(segment.bounds.min, bounds.min);
+				segment.bounds.max = glm::max(segment.bounds.max, bounds.max);
+			}
+			else
+			{
+				segment.bounds = bounds;
+			}
+
+			float tilingFactor = sprite.texture ? sprite.tilingFactor : 1.0f;
+			vertices.resize(vertices.size() + 4);
+			WriteQuad(&vertices[vertices.size() - 4], transform, sprite.color, texCoords, textureIndex, tilingFactor, item.entityId);
+			segment.keys.push_back(key);
+			segment.quadCount++;
+		}
+
+		FinishStaticSegment(*batch, segment, vertices);
+		return batch;
+	}
+
+	void Renderer2D::DrawStaticBatch(const Ref<StaticBatch>& batch)
+	{
+		RB_PROFILE_FUNC();
+
+		if (!batch || batch->segments.empty())
+			return;
+
+		// Quads submitted before this have to be drawn first to keep the order
+		if (sData.quads.GetCount() || sData.quadInstances.GetCount())
+			ResetBatch();
+
+		for (const auto& segment : batch->segments)
+			DrawStaticQuads(segment, 0, segment.quadCount);
 	}
 
 	void Renderer2D::DrawLine(const glm::vec3& start, const glm::vec3& end, const glm::vec4& color, int entityId /*= -1*/)
 	{
-		sData.lineVertexBufferPtr->position = start;
-		sData.lineVertexBufferPtr->color = color;
-		sData.lineVertexBufferPtr->entityId = entityId;
-		sData.lineVertexBufferPtr++;
+		LineVertex* vertices = sData.lines.Allocate();
 
-		sData.lineVertexBufferPtr->position = end;
-		sData.lineVertexBufferPtr->color = color;
-		sData.lineVertexBufferPtr->entityId = entityId;
-		sData.lineVertexBufferPtr++;
+		vertices[0].position = start;
+		vertices[0].color = color;
+		vertices[0].entityId = entityId;
 
-		sData.lineVertexCount += 2;
+		vertices[1].position = end;
+		vertices[1].color = color;
+		vertices[1].entityId = entityId;
 	}
 
 	void Renderer2D::DrawRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color, int entityId /*= -1*/)
@@ -620,14 +1236,59 @@ namespace rebirth
 		return sData.lineWidth;
 	}
 
+	void Renderer2D::SetCulling(bool enabled)
+	{
+		sData.culling = enabled;
+	}
+
+	bool Renderer2D::IsCullingEnabled()
+	{
+		return sData.culling;
+	}
+
+	void Renderer2D::SetSorting(bool enabled)
+	{
+		sData.sorting = enabled;
+	}
+
+	bool Renderer2D::IsSortingEnabled()
+	{
+		return sData.sorting;
+	}
+
 	Renderer2D::Stats Renderer2D::GetStats()
 	{
-		return sData.stats;
+		const BatchStats& quads = sData.quadPipeline == QuadPipeline::INSTANCED ? sData.quadInstances.GetStats() : sData.quads.GetStats();
+		const BatchStats& circles = sData.circles.GetStats();
+		const BatchStats& lines = sData.lines.GetStats();
+
+		Stats stats;
+		stats.drawCalls = quads.drawCalls + sData.staticStats.drawCalls + circles.drawCalls + lines.drawCalls;
+		stats.quads = quads.primitives;
+		stats.staticQuads = sData.staticStats.primitives;
+		stats.circles = circles.primitives;
+		stats.lines = lines.primitives;
+		stats.culled = sData.culledCount;
+		stats.submitted = sData.submittedCount;
+		stats.atlasPages = sData.textureAtlas->GetPageCount();
+		stats.atlasOccupancy = sData.textureAtlas->GetOccupancy();
+		return stats;
+	}
+
+	TextureAtlas& Renderer2D::GetTextureAtlas()
+	{
+		return *sData.textureAtlas;
 	}
 
 	void Renderer2D::ResetStats()
 	{
-		memset(&sData.stats, 0, sizeof(Stats));
+		sData.quads.ResetStats();
+		sData.quadInstances.ResetStats();
+		sData.circles.ResetStats();
+		sData.lines.ResetStats();
+		sData.staticStats = {};
+		sData.culledCount = 0;
+		sData.submittedCount = 0;
 	}
 
 
@@ -27,6 +27,7 @@
 
 #include "Texture.h"
 #include "SubTexture.h"
+#include "TextureAtlas.h"
 #include "EditorCamera.h"
 
 #include "rebirth/scene/Components.h"
@@ -36,8 +37,13 @@ namespace rebirth
 	class Renderer2D
 	{
 	public:
+		enum class QuadPipeline
+		{
+			VERTEX = 0,	// 4 vertices per quad, built on the CPU
+			INSTANCED	// 1 instance per quad, the corners are expanded in the vertex shader
+		};
 
-		static void Init();
+		static void Init(QuadPipeline pipeline = QuadPipeline::VERTEX);
 		static void Shutdown();
 
 		static void BeginScene(const Camera& camera, const glm::mat4& transform);
@@ -47,6 +53,8 @@ namespace rebirth
 
 		static void Flush();
 
+		static QuadPipeline GetQuadPipeline();
+
 		static void DrawQuad(const glm::mat4& transform, const glm::vec4& color, int entityId = -1);
 		static void DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = {1.0f, 1.0f, 1.0f, 1.0f}, int entityId = -1);
 		static void DrawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subtexture, float tilingFactor = 1.0f, const glm::vec4& tintColor = {1.0f, 1.0f, 1.0f, 1.0f}, int entityId = -1);
@@ -72,6 +80,41 @@ namespace rebirth
 
 		static void DrawSprite(const glm::mat4& transform, SpriteComponent& spriteComponent, int entityId);
 
+		// Input for the parallel submission path, the components must stay alive until the call returns
+		struct SpriteDrawItem
+		{
+			const glm::mat4* transform; // WorldTransformComponent::transform
+			const SpriteComponent* sprite;
+			int entityId;
+		};
+
+		struct CircleDrawItem
+		{
+			const glm::mat4* transform; // WorldTransformComponent::transform
+			const CircleComponent* circle;
+			int entityId;
+		};
+
+		// Sprites baked into GPU buffers once and redrawn as is every frame. Always uses
+		// the vertex quad layout, whichever pipeline the dynamic quads go through
+		struct StaticBatch;
+
+		// Same batches and draw order as calling DrawSprite/DrawCircle for each item,
+		// but culling and building the vertices are done on multiple threads.
+		// With sorting on the visible sprites, circles and the quads of staticBatch are drawn as one stream
+		// in SortKey order, flushing whenever the primitive changes. With it off the static batch goes
+		// under the sprites and the circles over them
+		static void DrawRenderables(const std::vector<SpriteDrawItem>& sprites, const std::vector<CircleDrawItem>& circles, const Ref<StaticBatch>& staticBatch = nullptr);
+		// Only order against what the same call draws, use DrawRenderables for layers to apply across both
+		static void DrawSprites(const std::vector<SpriteDrawItem>& sprites, const Ref<StaticBatch>& staticBatch = nullptr);
+		static void DrawCircles(const std::vector<CircleDrawItem>& circles);
+
+		// Orders the sprites by SortKey, a new segment starts when the texture slots or the index buffer run out.
+		// Has to be rebuilt when any of the sprites or their transforms change
+		static Ref<StaticBatch> BuildStaticBatch(const std::vector<SpriteDrawItem>& sprites);
+		// The whole batch in key order on its own, DrawSprites merges it with the sprites instead
+		static void DrawStaticBatch(const Ref<StaticBatch>& batch);
+
 		static void DrawCircle(const glm::mat4& transform, const glm::vec4& color, float thickness = 1.0f, float fade = 0.005f, int entityId = -1);
 
 		static void DrawLine(const glm::vec3& start, const glm::vec3& end, const glm::vec4& color, int entityId = -1);
@@ -82,17 +125,36 @@ namespace rebirth
 		static void SetLineWidth(float width);
 		static float GetLineWidth();
 
+		// Sprites and circles outside the camera are skipped, on by default
+		static void SetCulling(bool enabled);
+		static bool IsCullingEnabled();
+
+		// DrawRenderables/DrawSprites/DrawCircles radix sort their items by layer, depth, shader and texture before batching,
+		// off by default. Immediate DrawQuad calls keep their submission order
+		static void SetSorting(bool enabled);
+		static bool IsSortingEnabled();
+
 		struct Stats
 		{
 			uint32 drawCalls = 0;
 			uint32 quads = 0;
-
-			uint32 GetVertCount() { return quads * 4; }
-			uint32 GetIndicesCount() { return quads * 6; }
+			uint32 staticQuads = 0; // drawn straight from static batches
+			uint32 circles = 0;
+			uint32 lines = 0;
+			uint32 culled = 0; // sprites and circles rejected by the camera frustum
+			uint32 submitted = 0; // sprites and circles that passed
+			uint32 atlasPages = 0;
+			float atlasOccupancy = 0.0f;
+
+			uint32 GetVertCount() { return (quads + staticQuads + circles) * 4 + lines * 2; }
+			uint32 GetIndicesCount() { return (quads + staticQuads + circles) * 6; }
 		};
 		static Stats GetStats();
 		static void ResetStats();
 
+		// Shared atlas sprite textures are packed into so they can be drawn in a single batch
+		static TextureAtlas& GetTextureAtlas();
+
 	private:
 		static void StartBatch();
 		static void ResetBatch();
@@ -27,6 +27,9 @@
 
 #include "Renderer.h"
 #include "platform/opengl/OpenGLShader.h"
+#include "platform/null/NullShader.h"
+
+#include <fstream>
 
 namespace rebirth
 {
@@ -39,14 +42,28 @@ namespace rebirth
 				RB_CORE_ASSERT(false, "Must use a graphics API");
 				return nullptr;
 
-			case GraphicsAPI::API::OPENGL: return createRef<OpenGLShader>(name, vertexSrc, fragSrc);
+			case GraphicsAPI::API::OPENGL:
+			{
+				Ref<Shader> shader = createRef<OpenGLShader>(name, vertexSrc, fragSrc);
+				shader->Link();
+				return shader;
+			}
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullShader>(name, vertexSrc, fragSrc);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
 		return nullptr;
 	}
 
-	Ref<Shader> Shader::Create(const std::string& filepath)
+	Ref<Shader> Shader::Create(const std::string& filepath, const ShaderDefines& defines)
+	{
+		Ref<Shader> shader = CreateUnlinked(filepath, defines);
+		if (shader)
+			shader->Link();
+		return shader;
+	}
+
+	Ref<Shader> Shader::CreateUnlinked(const std::string& filepath, const ShaderDefines& defines)
 	{
 		switch (Renderer::GetAPI())
 		{
@@ -54,13 +71,73 @@ namespace rebirth
 				RB_CORE_ASSERT(false, "Must use a graphics API");
 				return nullptr;
 
-			case GraphicsAPI::API::OPENGL: return createRef<OpenGLShader>(filepath);
+			case GraphicsAPI::API::OPENGL: return createRef<OpenGLShader>(filepath, defines);
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullShader>(filepath, defines);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
 		return nullptr;
 	}
 
+	std::string Shader::GetVariantName(const ShaderDefines& defines)
+	{
+		ShaderDefines sorted = defines;
+		std::sort(sorted.begin(), sorted.end(), [](const ShaderDefine& a, const ShaderDefine& b) { return a.name < b.name; });
+
+		std::string name;
+		for (const auto& define : sorted)
+		{
+			if (!name.empty())
+				name += ',';
+			name += define.name;
+			if (!define.value.empty())
+				name += '=' + define.value;
+		}
+		return name;
+	}
+
+	static std::string TrimDefine(const std::string& str)
+	{
+		size_t first = str.find_first_not_of(" \t\r");
+		if (first == std::string::npos)
+			return std::string();
+		size_t last = str.find_last_not_of(" \t\r");
+		return str.substr(first, last - first + 1);
+	}
+
+	std::vector<ShaderDefines> Shader::ReadVariants(const std::string& filepath)
+	{
+		std::vector<ShaderDefines> variants(1);
+
+		std::ifstream in(filepath);
+		std::string line;
+		while (std::getline(in, line))
+		{
+			if (line.rfind("#type", 0) == 0)
+				break;
+			if (line.rfind("#variant", 0) != 0)
+				continue;
+
+			ShaderDefines defines;
+			std::stringstream list(line.substr(strlen("#variant")));
+			std::string define;
+			while (std::getline(list, define, ','))
+			{
+				define = TrimDefine(define);
+				if (define.empty())
+					continue;
+
+				size_t equals = define.find('=');
+				if (equals == std::string::npos)
+					defines.push_back({ define, std::string() });
+				else
+					defines.push_back({ TrimDefine(define.substr(0, equals)), TrimDefine(define.substr(equals + 1)) });
+			}
+			variants.push_back(defines);
+		}
+		return variants;
+	}
+
 	Ref<rebirth::Shader> Shader::Create(const std::string& vertexPath, const std::string& pixelPath)
 	{
 		switch (Renderer::GetAPI())
@@ -69,7 +146,13 @@ namespace rebirth
 				RB_CORE_ASSERT(false, "Must use a graphics API");
 				return nullptr;
 
-			case GraphicsAPI::API::OPENGL: return createRef<OpenGLShader>(vertexPath, pixelPath);
+			case GraphicsAPI::API::OPENGL:
+			{
+				Ref<Shader> shader = createRef<OpenGLShader>(vertexPath, pixelPath);
+				shader->Link();
+				return shader;
+			}
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullShader>(vertexPath, pixelPath);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
@@ -109,6 +192,24 @@ namespace rebirth
 		return shader;
 	}
 
+	void ShaderLibrary::LoadAsync(const std::string& filepath)
+	{
+		Ref<Shader>* shader = &mPendingLoads.emplace_back();
+		JobSystem::Execute("ShaderLibrary::LoadAsync", [filepath, shader]() { *shader = Shader::CreateUnlinked(filepath); }, &mLoads);
+	}
+
+	void ShaderLibrary::WaitForLoads()
+	{
+		RB_PROFILE_FUNC();
+		JobSystem::Wait(mLoads);
+		for (auto& shader : mPendingLoads)
+		{
+			shader->Link();
+			Add(shader);
+		}
+		mPendingLoads.clear();
+	}
+
 	Ref<Shader> ShaderLibrary::Get(const std::string& name)
 	{
 		RB_CORE_ASSERT(mShaders.find(name) != mShaders.end(), "Shader [{}] was not found in the library", name);
@@ -120,4 +221,39 @@ namespace rebirth
 		return Get(name);
 	}
 
+	Ref<Shader> ShaderVariants::Get(const ShaderDefines& defines)
+	{
+		std::string name = Shader::GetVariantName(defines);
+		auto it = mVariants.find(name);
+		if (it != mVariants.end())
+			return it->second;
+
+		RB_CORE_INFO("Compiling variant [{}] of {}", name, mFilepath);
+		Ref<Shader> shader = Shader::Create(mFilepath, defines);
+		mVariants[name] = shader;
+		return shader;
+	}
+
+	void ShaderVariants::LoadAsync(const ShaderDefines& defines)
+	{
+		std::string name = Shader::GetVariantName(defines);
+		if (mVariants.find(name) != mVariants.end())
+			return;
+
+		Ref<Shader>* shader = &mPendingLoads.emplace_back(name, nullptr).second;
+		JobSystem::Execute("ShaderVariants::LoadAsync", [filepath = mFilepath, defines, shader]() { *shader = Shader::CreateUnlinked(filepath, defines); }, &mLoads);
+	}
+
+	void ShaderVariants::WaitForLoads()
+	{
+		RB_PROFILE_FUNC();
+		JobSystem::Wait(mLoads);
+		for (auto& [name, shader] : mPendingLoads)
+		{
+			shader->Link();
+			mVariants[name] = shader;
+		}
+		mPendingLoads.clear();
+	}
+
 }
\ No newline at end of file
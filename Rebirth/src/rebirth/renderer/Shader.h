@@ -23,8 +23,66 @@
 
 #pragma once
 
+#include <deque>
+#include <string_view>
+
+#include "Buffer.h"
+#include "rebirth/core/JobSystem.h"
+
 namespace rebirth
 {
+	// A uniform name hashed once, shaders resolve it to a location with a single table lookup.
+	// Passing a literal converts implicitly, declare handles constexpr to be sure it's hashed at compile time
+	struct ShaderUniformHandle
+	{
+		uint32 hash = 0;
+
+		constexpr ShaderUniformHandle() = default;
+		constexpr ShaderUniformHandle(const char* name) : hash(Hash(name)) {}
+		explicit ShaderUniformHandle(const std::string& name) : hash(Hash(name)) {}
+
+		// 32 bit FNV-1a
+		static constexpr uint32 Hash(std::string_view name)
+		{
+			uint32 result = 2166136261u;
+			for (char c : name)
+			{
+				result ^= (uint8)c;
+				result *= 16777619u;
+			}
+			return result;
+		}
+
+		constexpr bool operator==(const ShaderUniformHandle& other) const { return hash == other.hash; }
+	};
+
+	// One uniform of a SetUniforms call, data only has to stay valid until the call returns
+	struct ShaderUniformValue
+	{
+		ShaderUniformHandle uniform;
+		ShaderDataType type = ShaderDataType::NONE;
+		const void* data = nullptr;
+		uint32 count = 1;
+
+		ShaderUniformValue(ShaderUniformHandle pUniform, const int& value) : uniform(pUniform), type(ShaderDataType::INT), data(&value) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const int* values, uint32 pCount) : uniform(pUniform), type(ShaderDataType::INT), data(values), count(pCount) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const float& value) : uniform(pUniform), type(ShaderDataType::FLOAT), data(&value) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const glm::vec2& value) : uniform(pUniform), type(ShaderDataType::FLOAT2), data(&value) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const glm::vec3& value) : uniform(pUniform), type(ShaderDataType::FLOAT3), data(&value) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const glm::vec4& value) : uniform(pUniform), type(ShaderDataType::FLOAT4), data(&value) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const glm::mat3& value) : uniform(pUniform), type(ShaderDataType::MAT3), data(&value) {}
+		ShaderUniformValue(ShaderUniformHandle pUniform, const glm::mat4& value) : uniform(pUniform), type(ShaderDataType::MAT4), data(&value) {}
+	};
+
+	// A #define a shader is compiled with, an empty value defines the name on its own
+	struct ShaderDefine
+	{
+		std::string name;
+		std::string value;
+	};
+
+	using ShaderDefines = std::vector<ShaderDefine>;
+
 	class Shader
 	{
 	public:
@@ -35,18 +93,37 @@ namespace rebirth
 
 		virtual const std::string& GetName() const = 0;
 
-		virtual void SetInt(const std::string& name, const int value) = 0;
-		virtual void SetIntArray(const std::string& name, const int* values, const uint32 count) = 0;
-		virtual void SetFloat(const std::string& name, const float value) = 0;
-		virtual void SetFloat2(const std::string& name, const glm::vec2& vec) = 0;
-		virtual void SetFloat3(const std::string& name, const glm::vec3& vec) = 0;
-		virtual void SetFloat4(const std::string& name, const glm::vec4& vec) = 0;
-		virtual void SetMat3(const std::string& name, const glm::mat3& matrix) = 0;
-		virtual void SetMat4(const std::string& name, const glm::mat4& matrix) = 0;
+		// Creates the GPU program. Only needed for shaders from CreateUnlinked, Create links right away
+		virtual void Link() = 0;
+
+		// Uniforms the shader doesn't have are ignored
+		virtual void SetInt(ShaderUniformHandle uniform, const int value) = 0;
+		virtual void SetIntArray(ShaderUniformHandle uniform, const int* values, const uint32 count) = 0;
+		virtual void SetFloat(ShaderUniformHandle uniform, const float value) = 0;
+		virtual void SetFloat2(ShaderUniformHandle uniform, const glm::vec2& vec) = 0;
+		virtual void SetFloat3(ShaderUniformHandle uniform, const glm::vec3& vec) = 0;
+		virtual void SetFloat4(ShaderUniformHandle uniform, const glm::vec4& vec) = 0;
+		virtual void SetMat3(ShaderUniformHandle uniform, const glm::mat3& matrix) = 0;
+		virtual void SetMat4(ShaderUniformHandle uniform, const glm::mat4& matrix) = 0;
+
+		// Updates all of them with a single recorded command
+		virtual void SetUniforms(const ShaderUniformValue* values, uint32 count) = 0;
+		void SetUniforms(std::initializer_list<ShaderUniformValue> values) { SetUniforms(values.begin(), (uint32)values.size()); }
 
 		static Ref<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& pixelSrc);
-		static Ref<Shader> Create(const std::string& filepath);
+		static Ref<Shader> Create(const std::string& filepath, const ShaderDefines& defines = {});
 		static Ref<Shader> Create(const std::string& vertexPath, const std::string& pixelPath);
+
+		// Does all the compiling but none of the graphics calls, so it can run on any thread.
+		// Link has to be called from the thread that owns the renderer before the shader is used
+		static Ref<Shader> CreateUnlinked(const std::string& filepath, const ShaderDefines& defines = {});
+
+		// NAME=VALUE pairs sorted by name, so the same defines in any order give the same variant.
+		// Empty for no defines
+		static std::string GetVariantName(const ShaderDefines& defines);
+
+		// The shader as is first, then one define set per "#variant NAME=VALUE,..." line above its first #type
+		static std::vector<ShaderDefines> ReadVariants(const std::string& filepath);
 	};
 
 	class ShaderLibrary
@@ -58,9 +135,38 @@ namespace rebirth
 		Ref<Shader> Load(const std::string& vertexPath, const std::string& pixelPath);
 		Ref<Shader> Load(const std::string& name, const std::string& vertexSrc, const std::string& pixelSrc);
 
+		// Starts compiling on a job thread. The shader is linked and added by WaitForLoads
+		void LoadAsync(const std::string& filepath);
+		void WaitForLoads();
+
 		Ref<Shader> Get(const std::string& name);
 		Ref<Shader> operator[](const std::string& name);
 	private:
 		std::unordered_map<std::string, Ref<Shader>> mShaders;
+		std::deque<Ref<Shader>> mPendingLoads; // Written by the jobs, a deque so the slots don't move
+		JobCounter mLoads;
+	};
+
+	// One shader file compiled into a separate program per set of defines. A variant is compiled
+	// the first time it's asked for and kept for as long as the set is
+	class ShaderVariants
+	{
+	public:
+		ShaderVariants() = default;
+		ShaderVariants(const std::string& filepath) : mFilepath(filepath) {}
+
+		Ref<Shader> Get(const ShaderDefines& defines);
+
+		// Same as ShaderLibrary, compiles on a job thread and WaitForLoads links
+		void LoadAsync(const ShaderDefines& defines);
+		void WaitForLoads();
+
+		const std::string& GetFilepath() const { return mFilepath; }
+		uint32 GetCount() const { return (uint32)mVariants.size(); }
+	private:
+		std::string mFilepath;
+		std::unordered_map<std::string, Ref<Shader>> mVariants; // by variant name
+		std::deque<std::pair<std::string, Ref<Shader>>> mPendingLoads;
+		JobCounter mLoads;
 	};
 }
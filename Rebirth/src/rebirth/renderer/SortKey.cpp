@@ -0,0 +1,92 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: SortKey.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "SortKey.h"
+
+namespace rebirth
+{
+	// Maps a float onto a uint32 with the same ordering, negatives included
+	static uint32 OrderedFloatBits(float value)
+	{
+		uint32 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+	}
+
+	uint64 SortKey::Make(int32 layer, float depth, uint32 shader, uint32 texture)
+	{
+		const uint64 layerBits = (uint64)(std::clamp(layer, MIN_LAYER, MAX_LAYER) - MIN_LAYER);
+
+		// Dropping the low mantissa bits still leaves about 5 significant digits
+		const uint64 depthBits = OrderedFloatBits(depth) >> 8;
+
+		return layerBits << 56
+			| depthBits << 32
+			| (uint64)(shader & 0xFF) << 24
+			| (uint64)(texture & 0xFFFFFF);
+	}
+
+	void SortKey::RadixSort(std::vector<SortItem>& items, std::vector<SortItem>& scratch)
+	{
+		RB_PROFILE_FUNC();
+
+		const uint32 count = (uint32)items.size();
+		if (count < 2)
+			return;
+		scratch.resize(count);
+
+		// Every pass's histogram comes out of a single read of the keys
+		uint32 histograms[8][256] = {};
+		for (const SortItem& item : items)
+		{
+			for (uint32 pass = 0; pass < 8; pass++)
+				histograms[pass][(item.key >> (pass * 8)) & 0xFF]++;
+		}
+
+		SortItem* src = items.data();
+		SortItem* dst = scratch.data();
+		for (uint32 pass = 0; pass < 8; pass++)
+		{
+			uint32* histogram = histograms[pass];
+			const uint32 shift = pass * 8;
+			if (histogram[(src[0].key >> shift) & 0xFF] == count)
+				continue;
+
+			uint32 offset = 0;
+			for (uint32 i = 0; i < 256; i++)
+			{
+				const uint32 bucketSize = histogram[i];
+				histogram[i] = offset;
+				offset += bucketSize;
+			}
+
+			for (uint32 i = 0; i < count; i++)
+				dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+
+			std::swap(src, dst);
+		}
+
+		if (src != items.data())
+			items.swap(scratch);
+	}
+}
@@ -0,0 +1,50 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: SortKey.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+namespace rebirth
+{
+	struct SortItem
+	{
+		uint64 key;
+		uint32 index; // into whatever list the keys were built from
+	};
+
+	// Packs a draw into 64 bits, from the most significant end:
+	// 8 bits layer, 24 bits depth, 8 bits shader, 24 bits texture.
+	// Ascending keys draw lower layers first, far before near within a layer (translation.z,
+	// smaller is further away) and keep draws sharing a shader and texture at the same depth together
+	class SortKey
+	{
+	public:
+		static constexpr int32 MIN_LAYER = -128;
+		static constexpr int32 MAX_LAYER = 127;
+
+		static uint64 Make(int32 layer, float depth, uint32 shader, uint32 texture);
+
+		// Stable LSD radix sort, one pass per key byte. A byte every key shares is skipped,
+		// so sorting keys that only differ in depth and texture takes 5 passes instead of 8.
+		// scratch is resized to match and used as the second buffer
+		static void RadixSort(std::vector<SortItem>& items, std::vector<SortItem>& scratch);
+	};
+}
@@ -27,9 +27,14 @@
 namespace rebirth
 {
 
-	SubTexture2D::SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max) :
-		mTexture(texture)
+	SubTexture2D::SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max)
 	{
+		Set(texture, min, max);
+	}
+
+	void SubTexture2D::Set(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max)
+	{
+		mTexture = texture;
 		mTexCoords[0] = { min.x, min.y };
 		mTexCoords[1] = { max.x, min.y };
 		mTexCoords[2] = { max.x, max.y };
@@ -34,6 +34,8 @@ namespace rebirth
 		const Ref<Texture2D> GetTexture() const { return mTexture; }
 		const glm::vec2* GetTexCoords() const { return mTexCoords; }
 
+		void Set(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max);
+
 		static Ref<SubTexture2D> CreateFromCoords(const Ref<Texture2D>& texture, const glm::vec2& coords, const glm::vec2& cellSize, const glm::vec2& spriteSize = {1, 1});
 	private:
 		Ref<Texture2D> mTexture;
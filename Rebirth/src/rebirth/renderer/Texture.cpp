@@ -24,20 +24,16 @@
 #include "Texture.h"
 
 #include "Renderer.h"
+#include "TextureStreamer.h"
+#include "TextureCache.h"
+#include "CookedTexture.h"
 #include "platform/opengl/OpenGLTexture.h"
+#include "platform/null/NullTexture.h"
 
 namespace rebirth
 {
-	// Temporary texture asset management system
-	static std::unordered_map<std::string, Ref<Texture2D>> sTextures;
-
-	Ref<Texture2D> Texture2D::Create(const std::string& path)
+	static Ref<Texture2D> CreateFromFile(const std::string& path, const bool async)
 	{
-		if (sTextures.find(path) != sTextures.end())
-		{
-			return sTextures[path];
-		}
-
 		switch (Renderer::GetAPI())
 		{
 			case GraphicsAPI::API::NONE:
@@ -46,18 +42,46 @@ namespace rebirth
 				return nullptr;
 			}
 
-			case GraphicsAPI::API::OPENGL:
-			{
-				Ref<Texture2D> tex = createRef<OpenGLTexture2D>(path);
-				sTextures[path] = tex;
-				return tex;
-			}
+			case GraphicsAPI::API::OPENGL: return createRef<OpenGLTexture2D>(path, async);
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullTexture2D>(path, async);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
 		return nullptr;
 	}
 
+	Ref<Texture2D> Texture2D::Create(const std::string& path)
+	{
+		if (Ref<Texture2D> cached = TextureCache::Find(path))
+			return cached;
+
+		Ref<Texture2D> tex = CreateFromFile(path, false);
+		if (tex)
+			TextureCache::Add(path, tex);
+		return tex;
+	}
+
+	Ref<Texture2D> Texture2D::CreateAsync(const std::string& path)
+	{
+		// Nothing to stream with yet, e.g. the default texture itself
+		if (!TextureStreamer::IsRunning())
+			return Create(path);
+
+		if (Ref<Texture2D> cached = TextureCache::Find(path))
+			return cached;
+
+		// Cooked textures upload straight out of a mapping, there's nothing for a worker to decode
+		const bool async = CookedTexture::FindCooked(path).empty();
+		Ref<Texture2D> tex = CreateFromFile(path, async);
+		if (!tex)
+			return nullptr;
+
+		TextureCache::Add(path, tex);
+		if (async)
+			TextureStreamer::Load(tex);
+		return tex;
+	}
+
 	Ref<Texture2D> Texture2D::Create(uint32 width, uint32 height)
 	{
 		switch (Renderer::GetAPI())
@@ -69,6 +93,7 @@ namespace rebirth
 			}
 
 			case GraphicsAPI::API::OPENGL: return createRef<OpenGLTexture2D>(width, height);
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullTexture2D>(width, height);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
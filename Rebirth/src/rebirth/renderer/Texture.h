@@ -32,11 +32,19 @@ namespace rebirth
 		virtual void Bind(uint32 slot = 0) const = 0;
 
 		virtual void SetData(void* data, uint32 size) = 0;
+		// Data is always RGBA8, regardless of the texture's own format
+		virtual void SetSubData(const void* data, uint32 x, uint32 y, uint32 width, uint32 height) = 0;
+		// Reads the whole texture back as RGBA8
+		virtual bool ReadPixels(std::vector<byte>& outData) const = 0;
 
 		virtual int GetWidth() const = 0;
 		virtual int GetHeight() const = 0;
 		virtual uint32 GetId() const = 0;
 		virtual const std::string& GetPath() const = 0;
+		// More than one for cooked textures, which come with their whole mip chain
+		virtual uint32 GetMipLevels() const = 0;
+		// Bytes of texture memory it occupies, 0 until loaded
+		virtual uint64 GetMemorySize() const = 0;
 
 		virtual bool IsLoaded() const = 0;
 
@@ -49,7 +57,18 @@ namespace rebirth
 		virtual ~Texture2D() = default;
 
 		static Ref<Texture2D> Create(const std::string& path);
+		// Returns right away and loads the file through the TextureStreamer. Until IsLoaded the
+		// texture binds Assets::GetDefaultTexture in its place
+		static Ref<Texture2D> CreateAsync(const std::string& path);
 		static Ref<Texture2D> Create(uint32 width, uint32 height);
 
+	protected:
+		friend class TextureStreamer;
+
+		// Called by the TextureStreamer. BeginUpload runs on the render thread, the rest on the main thread
+		virtual void BeginUpload(uint32 width, uint32 height, uint32 channels) = 0;
+		// Rows are tightly packed with the channel count given to BeginUpload
+		virtual void UploadRows(const byte* pixels, uint32 firstRow, uint32 rowCount) = 0;
+		virtual void EndUpload() = 0;
 	};
 }
\ No newline at end of file
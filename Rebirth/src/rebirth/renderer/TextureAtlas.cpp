@@ -0,0 +1,243 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureAtlas.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "TextureAtlas.h"
+#include "TextureStreamer.h"
+
+namespace rebirth
+{
+
+	TextureAtlas::TextureAtlas(uint32 pageSize, uint32 maxTextureSize, uint32 padding) :
+		mPageSize(pageSize), mMaxTextureSize(maxTextureSize), mPadding(padding)
+	{
+		RB_CORE_ASSERT(maxTextureSize + padding * 2 <= pageSize, "Atlas pages must be able to fit the largest texture");
+	}
+
+	Ref<SubTexture2D> TextureAtlas::Pack(const Ref<Texture2D>& texture)
+	{
+		RB_PROFILE_FUNC();
+
+		if (!texture || texture->GetPath().empty())
+			return nullptr;
+
+		auto it = mRegions.find(texture->GetPath());
+		if (it != mRegions.end())
+			return it->second;
+
+		if (!texture->IsLoaded())
+		{
+			if (!TextureStreamer::IsPending(texture))
+				return nullptr;
+
+			Ref<SubTexture2D> region = createRef<SubTexture2D>(texture, glm::vec2(0.0f), glm::vec2(1.0f));
+			mRegions[texture->GetPath()] = region;
+
+			// Sprites already hold the region, so it's updated in place. Too big for a page just keeps the whole texture,
+			// and the atlas lets go of the region so the texture can still be evicted once the sprites are gone
+			std::weak_ptr<SubTexture2D> weakRegion = region;
+			TextureStreamer::OnLoaded(texture, [this, weakRegion](const Ref<Texture2D>& loaded)
+				{
+					auto region = weakRegion.lock();
+					auto it = mRegions.find(loaded->GetPath());
+					if (region && it != mRegions.end() && it->second == region && !Place(loaded, *region))
+						mRegions.erase(it);
+				});
+			return region;
+		}
+
+		Ref<SubTexture2D> region = createRef<SubTexture2D>(texture, glm::vec2(0.0f), glm::vec2(1.0f));
+		if (!Place(texture, *region))
+			return nullptr;
+
+		mRegions[texture->GetPath()] = region;
+		return region;
+	}
+
+	bool TextureAtlas::Place(const Ref<Texture2D>& texture, SubTexture2D& region)
+	{
+		RB_PROFILE_FUNC();
+
+		const uint32 width = (uint32)texture->GetWidth();
+		const uint32 height = (uint32)texture->GetHeight();
+		if (width > mMaxTextureSize || height > mMaxTextureSize)
+			return false;
+
+		// Pages only hold one RGBA8 level, a cooked texture keeps its mips and compression by being drawn on its own
+		if (texture->GetMipLevels() > 1)
+			return false;
+
+		std::vector<byte> pixels;
+		if (!texture->ReadPixels(pixels))
+			return false;
+
+		const uint32 paddedWidth = width + mPadding * 2;
+		const uint32 paddedHeight = height + mPadding * 2;
+
+		Page* target = nullptr;
+		uint32 x = 0, y = 0;
+		size_t node = 0;
+		for (auto& page : mPages)
+		{
+			if (FindPosition(page, paddedWidth, paddedHeight, x, y, node))
+			{
+				target = &page;
+				break;
+			}
+		}
+
+		if (!target)
+		{
+			target = &CreatePage();
+			bool fits = FindPosition(*target, paddedWidth, paddedHeight, x, y, node);
+			RB_CORE_ASSERT(fits, "Texture does not fit in an empty atlas page");
+		}
+
+		AddSkylineLevel(*target, node, x, y, paddedWidth, paddedHeight);
+		target->usedArea += (uint64)paddedWidth * paddedHeight;
+
+		// Extrude the edge pixels into the padding so linear filtering doesn't bleed in the neighbours
+		std::vector<byte> padded((size_t)paddedWidth * paddedHeight * 4);
+		for (uint32 py = 0; py < paddedHeight; py++)
+		{
+			uint32 sy = (uint32)std::clamp((int)py - (int)mPadding, 0, (int)height - 1);
+			for (uint32 px = 0; px < paddedWidth; px++)
+			{
+				uint32 sx = (uint32)std::clamp((int)px - (int)mPadding, 0, (int)width - 1);
+				memcpy(&padded[((size_t)py * paddedWidth + px) * 4], &pixels[((size_t)sy * width + sx) * 4], 4);
+			}
+		}
+		target->texture->SetSubData(padded.data(), x, y, paddedWidth, paddedHeight);
+
+		float pageSize = (float)mPageSize;
+		glm::vec2 min = { (x + mPadding) / pageSize, (y + mPadding) / pageSize };
+		glm::vec2 max = { (x + mPadding + width) / pageSize, (y + mPadding + height) / pageSize };
+
+		region.Set(target->texture, min, max);
+		return true;
+	}
+
+	void TextureAtlas::Clear()
+	{
+		mPages.clear();
+		mRegions.clear();
+	}
+
+	float TextureAtlas::GetOccupancy() const
+	{
+		if (mPages.empty())
+			return 0.0f;
+
+		uint64 used = 0;
+		for (const auto& page : mPages)
+			used += page.usedArea;
+
+		return (float)((double)used / ((double)mPageSize * mPageSize * mPages.size()));
+	}
+
+	TextureAtlas::Page& TextureAtlas::CreatePage()
+	{
+		RB_CORE_TRACE("Creating texture atlas page {} ({}x{})", mPages.size(), mPageSize, mPageSize);
+
+		Page& page = mPages.emplace_back();
+		page.texture = Texture2D::Create(mPageSize, mPageSize);
+		page.skyline.push_back({ 0, 0, mPageSize });
+		return page;
+	}
+
+	bool TextureAtlas::FindPosition(const Page& page, uint32 width, uint32 height, uint32& outX, uint32& outY, size_t& outNode) const
+	{
+		uint32 bestY = UINT32_MAX;
+		uint32 bestWidth = UINT32_MAX;
+
+		for (size_t i = 0; i < page.skyline.size(); i++)
+		{
+			uint32 x = page.skyline[i].x;
+			if (x + width > mPageSize)
+				break;
+
+			// Rest on the highest node under the span
+			uint32 y = 0;
+			uint32 remaining = width;
+			for (size_t j = i; remaining > 0; j++)
+			{
+				y = std::max(y, page.skyline[j].y);
+				remaining -= std::min(remaining, page.skyline[j].width);
+			}
+
+			if (y + height > mPageSize)
+				continue;
+
+			if (y < bestY || (y == bestY && page.skyline[i].width < bestWidth))
+			{
+				bestY = y;
+				bestWidth = page.skyline[i].width;
+				outX = x;
+				outY = y;
+				outNode = i;
+			}
+		}
+
+		return bestY != UINT32_MAX;
+	}
+
+	void TextureAtlas::AddSkylineLevel(Page& page, size_t node, uint32 x, uint32 y, uint32 width, uint32 height)
+	{
+		auto& skyline = page.skyline;
+		skyline.insert(skyline.begin() + node, { x, y + height, width });
+
+		// Trim or remove the nodes now covered by the new one
+		for (size_t i = node + 1; i < skyline.size();)
+		{
+			const auto& prev = skyline[i - 1];
+			uint32 prevEnd = prev.x + prev.width;
+			if (skyline[i].x >= prevEnd)
+				break;
+
+			uint32 shrink = prevEnd - skyline[i].x;
+			if (skyline[i].width <= shrink)
+			{
+				skyline.erase(skyline.begin() + i);
+				continue;
+			}
+
+			skyline[i].x += shrink;
+			skyline[i].width -= shrink;
+			break;
+		}
+
+		// Merge neighbours at the same height
+		for (size_t i = 0; i + 1 < skyline.size();)
+		{
+			if (skyline[i].y == skyline[i + 1].y)
+			{
+				skyline[i].width += skyline[i + 1].width;
+				skyline.erase(skyline.begin() + i + 1);
+			}
+			else
+			{
+				i++;
+			}
+		}
+	}
+
+}
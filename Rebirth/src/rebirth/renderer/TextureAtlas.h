@@ -0,0 +1,78 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureAtlas.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Texture.h"
+#include "SubTexture.h"
+
+namespace rebirth
+{
+	// Packs small textures into large RGBA8 pages so sprites using them can share a batch.
+	// Each page is filled with a skyline bottom-left packer
+	class TextureAtlas
+	{
+	public:
+		TextureAtlas(uint32 pageSize = 2048, uint32 maxTextureSize = 512, uint32 padding = 2);
+
+		// Returns the region of the page the texture was copied into, or nullptr if the texture
+		// can't be atlased (too big, cooked with mips, not loaded from a file or failed to read back).
+		// A texture still streaming in gets a region covering all of itself, which moves into a page once it loads
+		Ref<SubTexture2D> Pack(const Ref<Texture2D>& texture);
+
+		void Clear();
+
+		uint32 GetPageCount() const { return (uint32)mPages.size(); }
+		uint32 GetPageSize() const { return mPageSize; }
+		uint32 GetRegionCount() const { return (uint32)mRegions.size(); }
+
+		// Fraction of all page area that is in use, 0 - 1
+		float GetOccupancy() const;
+
+	private:
+		struct SkylineNode
+		{
+			uint32 x;
+			uint32 y;
+			uint32 width;
+		};
+
+		struct Page
+		{
+			Ref<Texture2D> texture;
+			std::vector<SkylineNode> skyline;
+			uint64 usedArea = 0;
+		};
+
+		bool Place(const Ref<Texture2D>& texture, SubTexture2D& region);
+		Page& CreatePage();
+		bool FindPosition(const Page& page, uint32 width, uint32 height, uint32& outX, uint32& outY, size_t& outNode) const;
+		void AddSkylineLevel(Page& page, size_t node, uint32 x, uint32 y, uint32 width, uint32 height);
+
+		uint32 mPageSize;
+		uint32 mMaxTextureSize;
+		uint32 mPadding;
+
+		std::vector<Page> mPages;
+		std::unordered_map<std::string, Ref<SubTexture2D>> mRegions;
+	};
+}
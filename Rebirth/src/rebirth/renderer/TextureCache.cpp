@@ -0,0 +1,117 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureCache.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "TextureCache.h"
+
+namespace rebirth
+{
+	std::unordered_map<std::string, TextureCache::Entry> TextureCache::sEntries;
+	std::unordered_map<std::string, std::string> TextureCache::sKeys;
+	uint64 TextureCache::sFrame = 0;
+	uint64 TextureCache::sBudget = TextureCache::DEFAULT_BUDGET;
+	TextureCache::Stats TextureCache::sStats;
+
+	Ref<Texture2D> TextureCache::Find(const std::string& path)
+	{
+		auto it = sEntries.find(GetKey(path));
+		if (it == sEntries.end())
+		{
+			sStats.misses++;
+			return nullptr;
+		}
+
+		sStats.hits++;
+		it->second.lastUsed = sFrame;
+		return it->second.texture;
+	}
+
+	void TextureCache::Add(const std::string& path, const Ref<Texture2D>& texture)
+	{
+		auto& entry = sEntries[GetKey(path)];
+		entry.texture = texture;
+		entry.lastUsed = sFrame;
+	}
+
+	void TextureCache::Trim()
+	{
+		RB_PROFILE_FUNC();
+		sFrame++;
+
+		// Streaming textures grow once they load, so the total is taken fresh each frame
+		uint64 resident = 0;
+		for (const auto& [key, entry] : sEntries)
+			resident += entry.texture->GetMemorySize();
+
+		if (resident > sBudget)
+		{
+			std::vector<std::pair<uint64, const std::string*>> unused;
+			for (const auto& [key, entry] : sEntries)
+			{
+				if (entry.texture.use_count() == 1)
+					unused.emplace_back(entry.lastUsed, &key);
+			}
+
+			std::sort(unused.begin(), unused.end());
+			for (const auto& [lastUsed, key] : unused)
+			{
+				if (resident <= sBudget)
+					break;
+
+				auto it = sEntries.find(*key);
+				RB_CORE_TRACE("Evicting texture {}", it->second.texture->GetPath());
+				resident -= it->second.texture->GetMemorySize();
+				sEntries.erase(it);
+				sStats.evictions++;
+			}
+		}
+
+		sStats.textures = (uint32)sEntries.size();
+		sStats.residentBytes = resident;
+	}
+
+	void TextureCache::Clear()
+	{
+		sEntries.clear();
+		sKeys.clear();
+		sStats.textures = 0;
+		sStats.residentBytes = 0;
+	}
+
+	void TextureCache::ResetStats()
+	{
+		sStats.hits = 0;
+		sStats.misses = 0;
+		sStats.evictions = 0;
+	}
+
+	const std::string& TextureCache::GetKey(const std::string& path)
+	{
+		auto it = sKeys.find(path);
+		if (it != sKeys.end())
+			return it->second;
+
+		std::error_code error;
+		std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+		return sKeys[path] = error ? path : canonical.generic_string();
+	}
+}
@@ -0,0 +1,77 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureCache.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Texture.h"
+
+namespace rebirth
+{
+	// Shares the textures loaded from files by their canonical path. When the resident textures go
+	// over the budget, the ones nothing outside the cache references are evicted least recently used first
+	class TextureCache
+	{
+	public:
+		struct Stats
+		{
+			uint64 hits = 0;
+			uint64 misses = 0;
+			uint64 evictions = 0;
+			uint32 textures = 0;
+			uint64 residentBytes = 0;
+
+			float GetHitRate() const { return hits + misses ? (float)((double)hits / (double)(hits + misses)) : 0.0f; }
+		};
+
+		static constexpr uint64 DEFAULT_BUDGET = 512ull * 1024 * 1024;
+
+		// Counts as a use of the texture, nullptr if it isn't cached
+		static Ref<Texture2D> Find(const std::string& path);
+		static void Add(const std::string& path, const Ref<Texture2D>& texture);
+
+		// Evicts down to the budget, called once a frame
+		static void Trim();
+		static void Clear();
+
+		static void SetBudget(uint64 bytes) { sBudget = bytes; }
+		static uint64 GetBudget() { return sBudget; }
+
+		static const Stats& GetStats() { return sStats; }
+		static void ResetStats();
+
+	private:
+		struct Entry
+		{
+			Ref<Texture2D> texture;
+			uint64 lastUsed = 0;
+		};
+
+		// Resolves a path as given to its cache key, remembered so repeated lookups don't touch the file system
+		static const std::string& GetKey(const std::string& path);
+
+		static std::unordered_map<std::string, Entry> sEntries;
+		static std::unordered_map<std::string, std::string> sKeys;
+		static uint64 sFrame;
+		static uint64 sBudget;
+		static Stats sStats;
+	};
+}
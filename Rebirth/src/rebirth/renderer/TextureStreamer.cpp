@@ -0,0 +1,260 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureStreamer.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "TextureStreamer.h"
+
+#include "RenderThread.h"
+#include "ImageLoader.h"
+
+#include <stb_image.h>
+
+namespace rebirth
+{
+	JobCounter TextureStreamer::sDecodeJobs;
+	std::mutex TextureStreamer::sMutex;
+	std::deque<TextureStreamer::DecodedImage> TextureStreamer::sDecodedImages;
+	std::deque<TextureStreamer::DecodedImage> TextureStreamer::sUploads;
+	std::unordered_set<Texture2D*> TextureStreamer::sPending;
+	std::unordered_map<Texture2D*, std::vector<TextureStreamer::LoadedCallback>> TextureStreamer::sCallbacks;
+	std::vector<TextureStreamer::FinishedTexture> TextureStreamer::sFinished;
+	uint32 TextureStreamer::sUploadBudget = TextureStreamer::DEFAULT_UPLOAD_BUDGET;
+	std::atomic<bool> TextureStreamer::sRunning = false;
+
+	void TextureStreamer::Init(const uint32 uploadBudget)
+	{
+		RB_PROFILE_FUNC();
+		RB_CORE_ASSERT(!sRunning, "Texture streamer is already running");
+
+		sUploadBudget = uploadBudget;
+		sRunning = true;
+
+		RB_CORE_TRACE("Texture streamer started with a {} byte upload budget", uploadBudget);
+	}
+
+	void TextureStreamer::Shutdown()
+	{
+		RB_PROFILE_FUNC();
+		if (!sRunning)
+			return;
+
+		// Decodes that haven't started return right away, the ones that have are waited for
+		sRunning = false;
+		JobSystem::Wait(sDecodeJobs);
+
+		for (auto& image : sDecodedImages)
+			ImageLoader::Free(image.pixels);
+		for (auto& image : sUploads)
+			ImageLoader::Free(image.pixels);
+
+		sDecodedImages.clear();
+		sUploads.clear();
+		sPending.clear();
+		sCallbacks.clear();
+		sFinished.clear();
+	}
+
+	void TextureStreamer::Load(const Ref<Texture2D>& texture)
+	{
+		RB_CORE_ASSERT(sRunning, "Texture streamer is not running");
+
+		sPending.insert(texture.get());
+		JobSystem::ExecuteBackground("TextureStreamer::Decode", [texture]() { Decode(texture); }, &sDecodeJobs);
+	}
+
+	void TextureStreamer::Update()
+	{
+		RB_PROFILE_FUNC();
+		// The frame that finished these was kicked at the end of the last one, an invoke waits for it
+		RunFinishedCallbacks();
+		if (sPending.empty())
+			return;
+
+		UploadDecoded(sUploadBudget);
+	}
+
+	void TextureStreamer::Flush()
+	{
+		RB_PROFILE_FUNC();
+		// Every queued texture ends up decoded, even ones that failed, so waiting on the jobs is enough
+		JobSystem::Wait(sDecodeJobs);
+		UploadDecoded(UINT64_MAX);
+
+		if (!sFinished.empty())
+		{
+			RenderThread::Kick();
+			RunFinishedCallbacks();
+		}
+	}
+
+	void TextureStreamer::OnLoaded(const Ref<Texture2D>& texture, const LoadedCallback& callback)
+	{
+		for (auto& finished : sFinished)
+		{
+			if (finished.texture == texture)
+			{
+				finished.callbacks.push_back(callback);
+				return;
+			}
+		}
+
+		if (texture->IsLoaded())
+		{
+			callback(texture);
+			return;
+		}
+
+		if (IsPending(texture))
+			sCallbacks[texture.get()].push_back(callback);
+	}
+
+	void TextureStreamer::UploadDecoded(uint64 budget)
+	{
+		size_t started = sUploads.size();
+		{
+			std::lock_guard lock(sMutex);
+			for (auto& image : sDecodedImages)
+				sUploads.push_back(image);
+			sDecodedImages.clear();
+		}
+
+		// Storage for everything that finished decoding is made in one go, the only point that waits on the render thread
+		if (started < sUploads.size())
+		{
+			RenderThread::Invoke([started]()
+				{
+					for (size_t i = started; i < sUploads.size(); i++)
+					{
+						const auto& image = sUploads[i];
+						if (image.pixels)
+							image.texture->BeginUpload(image.width, image.height, image.channels);
+					}
+				});
+		}
+
+		while (!sUploads.empty() && budget > 0)
+		{
+			auto& image = sUploads.front();
+			if (image.pixels)
+			{
+				// Always at least one row, so a budget smaller than a row still makes progress
+				const uint64 rowSize = (uint64)image.width * image.channels;
+				uint32 rows = (uint32)std::clamp<uint64>(budget / rowSize, 1, image.height - image.nextRow);
+				image.texture->UploadRows(image.pixels + rowSize * image.nextRow, image.nextRow, rows);
+				image.nextRow += rows;
+				budget -= std::min(budget, rowSize * rows);
+
+				if (image.nextRow < image.height)
+					break;
+			}
+
+			Finish(image);
+			sUploads.pop_front();
+		}
+	}
+
+	void TextureStreamer::Finish(DecodedImage& image)
+	{
+		auto callbacks = sCallbacks.find(image.texture.get());
+		std::vector<LoadedCallback> pending;
+		if (callbacks != sCallbacks.end())
+		{
+			pending = std::move(callbacks->second);
+			sCallbacks.erase(callbacks);
+		}
+
+		if (image.pixels)
+		{
+			image.texture->EndUpload();
+			ImageLoader::Free(image.pixels);
+			image.pixels = nullptr;
+
+			if (RenderThread::IsRunning())
+			{
+				sFinished.push_back({ image.texture, std::move(pending) });
+			}
+			else
+			{
+				for (const auto& callback : pending)
+					callback(image.texture);
+			}
+		}
+
+		sPending.erase(image.texture.get());
+	}
+
+	void TextureStreamer::RunFinishedCallbacks()
+	{
+		// Callbacks can register more callbacks or finish other textures
+		std::vector<FinishedTexture> finished = std::move(sFinished);
+		sFinished.clear();
+		for (const auto& entry : finished)
+		{
+			for (const auto& callback : entry.callbacks)
+				callback(entry.texture);
+		}
+	}
+
+	void TextureStreamer::Decode(const Ref<Texture2D>& texture)
+	{
+		if (!IsRunning())
+			return;
+
+		// Flips on the job thread only, the flag set by the synchronous loader is global
+		stbi_set_flip_vertically_on_load_thread(1);
+
+		const std::string& path = texture->GetPath();
+		int width, height, channels;
+		byte* pixels = nullptr;
+		{
+			RB_PROFILE_SCOPE("ImageLoader::Load in TextureStreamer::Decode");
+			pixels = ImageLoader::Load(path, width, height, channels);
+
+			// Textures are only made as RGB8 or RGBA8
+			if (pixels && channels != 3 && channels != 4)
+			{
+				ImageLoader::Free(pixels);
+				pixels = ImageLoader::Load(path, width, height, channels, 4);
+				channels = 4;
+			}
+		}
+
+		DecodedImage image;
+		image.texture = texture;
+		if (pixels)
+		{
+			image.pixels = pixels;
+			image.width = (uint32)width;
+			image.height = (uint32)height;
+			image.channels = (uint32)channels;
+		}
+		else
+		{
+			RB_CORE_ERROR("Failed to load texture {}", path);
+		}
+
+		{
+			std::lock_guard lock(sMutex);
+			sDecodedImages.push_back(std::move(image));
+		}
+	}
+}
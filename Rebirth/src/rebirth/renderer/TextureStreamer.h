@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: TextureStreamer.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Texture.h"
+#include "rebirth/core/JobSystem.h"
+
+#include <mutex>
+#include <deque>
+
+namespace rebirth
+{
+	// Loads the textures made with Texture2D::CreateAsync. Files are decoded as background jobs and
+	// the pixels are uploaded a few rows at a time from Update, so a frame never spends more than
+	// the upload budget on them
+	class TextureStreamer
+	{
+	public:
+		using LoadedCallback = std::function<void(const Ref<Texture2D>&)>;
+
+		static constexpr uint32 DEFAULT_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+		static void Init(uint32 uploadBudget = DEFAULT_UPLOAD_BUDGET);
+		// Anything still queued is dropped, those textures keep binding the default texture
+		static void Shutdown();
+		static bool IsRunning() { return sRunning.load(std::memory_order_acquire); }
+
+		static void Load(const Ref<Texture2D>& texture);
+
+		// Called once a frame on the main thread. Uploads up to the budget and runs the callbacks of textures that finished.
+		// With the render thread running, callbacks wait for the frame after the one that uploaded the last rows
+		static void Update();
+
+		// Blocks until everything queued is uploaded, ignoring the budget
+		static void Flush();
+
+		// Runs on the main thread once the texture has loaded, or right away if it already has.
+		// Dropped if the texture isn't streaming and never loaded
+		static void OnLoaded(const Ref<Texture2D>& texture, const LoadedCallback& callback);
+
+		static bool IsPending(const Ref<Texture2D>& texture) { return sPending.find(texture.get()) != sPending.end(); }
+
+		static void SetUploadBudget(uint32 bytes) { sUploadBudget = bytes; }
+		static uint32 GetUploadBudget() { return sUploadBudget; }
+
+		// Textures queued or partially uploaded
+		static uint32 GetPendingCount() { return (uint32)sPending.size(); }
+
+	private:
+		struct DecodedImage
+		{
+			Ref<Texture2D> texture;
+			byte* pixels = nullptr;
+			uint32 width = 0;
+			uint32 height = 0;
+			uint32 channels = 0;
+			uint32 nextRow = 0;
+		};
+
+		static void Decode(const Ref<Texture2D>& texture);
+		static void UploadDecoded(uint64 budget);
+		static void Finish(DecodedImage& image);
+
+		static JobCounter sDecodeJobs;
+		static std::mutex sMutex;
+		static std::deque<DecodedImage> sDecodedImages;
+
+		// Main thread only
+		static std::deque<DecodedImage> sUploads;
+		static std::unordered_set<Texture2D*> sPending;
+		static std::unordered_map<Texture2D*, std::vector<LoadedCallback>> sCallbacks;
+
+		// Textures whose last rows were only recorded, their callbacks run once that frame has been kicked
+		// so anything reading the texture back sees all of it
+		struct FinishedTexture
+		{
+			Ref<Texture2D> texture;
+			std::vector<LoadedCallback> callbacks;
+		};
+		static std::vector<FinishedTexture> sFinished;
+		static void RunFinishedCallbacks();
+
+		static uint32 sUploadBudget;
+		static std::atomic<bool> sRunning;
+	};
+}
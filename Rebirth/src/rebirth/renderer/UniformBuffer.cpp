@@ -25,6 +25,7 @@
 
 #include "Renderer.h"
 #include "platform/opengl/OpenGLUniformBuffer.h"
+#include "platform/null/NullUniformBuffer.h"
 
 
 namespace rebirth
@@ -39,6 +40,7 @@ namespace rebirth
 				return nullptr;
 
 			case GraphicsAPI::API::OPENGL: return createRef<OpenGLUniformBuffer>(size, binding);
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullUniformBuffer>(size, binding);
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
@@ -27,6 +27,7 @@
 
 #include "Renderer.h"
 #include "platform/opengl/OpenGLVertexArray.h"
+#include "platform/null/NullVertexArray.h"
 
 namespace rebirth
 {
@@ -42,6 +43,7 @@ namespace rebirth
 			}
 
 			case GraphicsAPI::API::OPENGL: return createRef<OpenGLVertexArray>();
+			case GraphicsAPI::API::NULL_RECORDING: return createRef<NullVertexArray>();
 		}
 
 		RB_CORE_ASSERT(false, "Unknown graphics API");
@@ -0,0 +1,130 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: VertexLayout.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Buffer.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <tuple>
+
+namespace rebirth
+{
+	// Storage for the packed attribute types, converted from the full precision value on assignment
+	struct PackedColor // UBYTE4_NORM, RGBA8
+	{
+		uint32 value = 0;
+
+		PackedColor() = default;
+		PackedColor(const glm::vec4& color) : value(glm::packUnorm4x8(color)) {}
+	};
+
+	struct Half // HALF
+	{
+		uint16 value = 0;
+
+		Half() = default;
+		Half(float v) : value(glm::packHalf1x16(v)) {}
+	};
+
+	struct Half2 // HALF2
+	{
+		uint32 value = 0;
+
+		Half2() = default;
+		Half2(const glm::vec2& v) : value(glm::packHalf2x16(v)) {}
+	};
+
+	struct Short2Norm // SHORT2_NORM, each component clamped to [-1, 1]
+	{
+		uint32 value = 0;
+
+		Short2Norm() = default;
+		Short2Norm(const glm::vec2& v) : value(glm::packSnorm2x16(v)) {}
+	};
+
+	struct UShort2Norm // USHORT2_NORM, each component clamped to [0, 1]. Steps of 1/65535, within a texel on any texture size
+	{
+		uint32 value = 0;
+
+		UShort2Norm() = default;
+		UShort2Norm(const glm::vec2& v) : value(glm::packUnorm2x16(v)) {}
+	};
+
+	template<typename T>
+	struct ShaderDataTypeOf;
+
+	template<> struct ShaderDataTypeOf<float> { static constexpr ShaderDataType value = ShaderDataType::FLOAT; };
+	template<> struct ShaderDataTypeOf<glm::vec2> { static constexpr ShaderDataType value = ShaderDataType::FLOAT2; };
+	template<> struct ShaderDataTypeOf<glm::vec3> { static constexpr ShaderDataType value = ShaderDataType::FLOAT3; };
+	template<> struct ShaderDataTypeOf<glm::vec4> { static constexpr ShaderDataType value = ShaderDataType::FLOAT4; };
+	template<> struct ShaderDataTypeOf<glm::mat3> { static constexpr ShaderDataType value = ShaderDataType::MAT3; };
+	template<> struct ShaderDataTypeOf<glm::mat4> { static constexpr ShaderDataType value = ShaderDataType::MAT4; };
+	template<> struct ShaderDataTypeOf<int> { static constexpr ShaderDataType value = ShaderDataType::INT; };
+	template<> struct ShaderDataTypeOf<glm::ivec2> { static constexpr ShaderDataType value = ShaderDataType::INT2; };
+	template<> struct ShaderDataTypeOf<glm::ivec3> { static constexpr ShaderDataType value = ShaderDataType::INT3; };
+	template<> struct ShaderDataTypeOf<glm::ivec4> { static constexpr ShaderDataType value = ShaderDataType::INT4; };
+	template<> struct ShaderDataTypeOf<bool> { static constexpr ShaderDataType value = ShaderDataType::BOOL; };
+	// Packed data, the shader reads the raw bits as an int
+	template<> struct ShaderDataTypeOf<uint32> { static constexpr ShaderDataType value = ShaderDataType::INT; };
+	template<> struct ShaderDataTypeOf<uint16> { static constexpr ShaderDataType value = ShaderDataType::UINT16; };
+	template<> struct ShaderDataTypeOf<PackedColor> { static constexpr ShaderDataType value = ShaderDataType::UBYTE4_NORM; };
+	template<> struct ShaderDataTypeOf<Half> { static constexpr ShaderDataType value = ShaderDataType::HALF; };
+	template<> struct ShaderDataTypeOf<Half2> { static constexpr ShaderDataType value = ShaderDataType::HALF2; };
+	template<> struct ShaderDataTypeOf<Short2Norm> { static constexpr ShaderDataType value = ShaderDataType::SHORT2_NORM; };
+	template<> struct ShaderDataTypeOf<UShort2Norm> { static constexpr ShaderDataType value = ShaderDataType::USHORT2_NORM; };
+
+	template<typename Vertex, typename Member>
+	struct VertexAttribute
+	{
+		using MemberType = Member;
+
+		Member Vertex::* member;
+		const char* name;
+	};
+
+	template<typename Vertex, typename Member>
+	constexpr VertexAttribute<Vertex, Member> Attribute(Member Vertex::* member, const char* name)
+	{
+		return { member, name };
+	}
+
+	// Vertex types describe themselves with a static constexpr Attributes() returning a tuple
+	// of Attribute(&Vertex::member, "aName"), in declaration order
+	template<typename Vertex>
+	constexpr uint32 VertexAttributesSize()
+	{
+		return std::apply([](auto... attributes) { return (0u + ... + (uint32)sizeof(typename decltype(attributes)::MemberType)); }, Vertex::Attributes());
+	}
+
+	template<typename Vertex>
+	BufferLayout MakeBufferLayout(bool perInstance = false)
+	{
+		static_assert(VertexAttributesSize<Vertex>() == sizeof(Vertex), "Vertex attributes must cover the whole vertex, with no padding");
+
+		return std::apply([perInstance](auto... attributes)
+			{
+				return BufferLayout({ BufferElement(ShaderDataTypeOf<typename decltype(attributes)::MemberType>::value, attributes.name)... }, perInstance);
+			}, Vertex::Attributes());
+	}
+}
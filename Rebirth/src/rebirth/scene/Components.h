@@ -26,8 +26,10 @@
 #include "rebirth/renderer/OrthoCamera.h"
 #include "SceneCamera.h"
 #include "rebirth/renderer/Texture.h"
+#include "rebirth/renderer/SubTexture.h"
 #include "rebirth/core/UUID.h"
 
+#include <entt.hpp>
 #include <glm/glm.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
@@ -75,12 +77,61 @@ namespace rebirth
 		const char* name = "TransformComponent";
 	};
 
+	// The parent's world matrix times the TransformComponent, rebuilt by the scene's per frame pass only when either changed.
+	// Added along with every TransformComponent and never saved
+	struct WorldTransformComponent
+	{
+		glm::mat4 transform{ 1.0f };
+
+		// What the matrix was built from. Compared by value, scripts and panels write the transform in place
+		glm::vec3 translation{ 0.0f };
+		glm::vec3 rotation{ 0.0f };
+		glm::vec3 scale{ 1.0f };
+
+		// Bumped on every rebuild, children rebuild when the version of their parent moved past the one they saw
+		uint32 version = 0;
+		uint32 parentVersion = 0;
+		bool dirty = true;
+
+		WorldTransformComponent() = default;
+		WorldTransformComponent(const WorldTransformComponent&) = default;
+
+		const char* name = "WorldTransformComponent";
+	};
+
+	// Every entity has one, a root just has no parent. Only the parent is saved, the rest is
+	// rebuilt by Scene::SortHierarchy which keeps the storage in depth first order
+	struct RelationshipComponent
+	{
+		UUID parent = 0;
+
+		entt::entity parentHandle = entt::null;
+		uint32 depth = 0;
+		uint32 order = 0;
+		// The parent's position in the sorted storage, UINT32_MAX for roots
+		uint32 parentIndex = UINT32_MAX;
+
+		RelationshipComponent() = default;
+		RelationshipComponent(const RelationshipComponent&) = default;
+
+		const char* name = "RelationshipComponent";
+	};
+
 	struct SpriteComponent
 	{
 		glm::vec4 color{ 1.0f };
 		Ref<Texture2D> texture;
 		float tilingFactor = 1.0f;
 
+		// Drawn over lower layers when Renderer2D sorting is on, clamped to SortKey::MIN_LAYER/MAX_LAYER
+		int32 layer = 0;
+
+		// Region of the renderer's texture atlas holding texture, if it could be packed. Runtime only
+		Ref<SubTexture2D> subTexture;
+
+		// Baked into the scene's static batch instead of being rebuilt every frame.
+		// Changing a static sprite in place needs Entity::Patch to be picked up
+		bool isStatic = false;
 
 		SpriteComponent() = default;
 		SpriteComponent(const SpriteComponent&) = default;
@@ -95,6 +146,8 @@ namespace rebirth
 		float thickness = 1.0f; // filled in circle
 		float fade = 0.005f;
 
+		// Same as SpriteComponent::layer, circles and sprites share the ordering
+		int32 layer = 0;
 
 		CircleComponent() = default;
 		CircleComponent(const CircleComponent&) = default;
@@ -194,6 +247,7 @@ namespace rebirth
 	using AllComponents_NoID_NoTag = ComponentGroup
 		<
 		TransformComponent,
+		RelationshipComponent,
 		SpriteComponent,
 		CircleComponent,
 		CameraComponent,
@@ -208,6 +262,7 @@ namespace rebirth
 		IDComponent,
 		TagComponent,
 		TransformComponent,
+		RelationshipComponent,
 		SpriteComponent,
 		CircleComponent,
 		CameraComponent,
@@ -75,6 +75,14 @@ namespace rebirth
 			mScene->mRegistry.remove<T>(mId);
 		}
 
+		// Lets the scene know a component was changed in place through GetComponent
+		template<typename T>
+		void Patch()
+		{
+			RB_CORE_ASSERT(HasComponent<T>(), "This entity does not have this component");
+			mScene->mRegistry.patch<T>(mId);
+		}
+
 		UUID GetUUID() { return GetComponent<IDComponent>().uuid; }
 		const std::string& GetTag() { return GetComponent<TagComponent>().tag; }
 
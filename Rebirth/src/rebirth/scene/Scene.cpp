@@ -35,6 +35,7 @@
 #include <box2d/b2_circle_shape.h>
 #include "../core/Application.h"
 #include "../events/SceneEvent.h"
+#include "../util/MathUtil.h"
 
 namespace rebirth
 {
@@ -55,6 +56,15 @@ namespace rebirth
 
 	Scene::Scene()
 	{
+		mRegistry.on_construct<SpriteComponent>().connect<&Scene::OnSpriteChanged>(this);
+		mRegistry.on_update<SpriteComponent>().connect<&Scene::OnSpriteChanged>(this);
+		mRegistry.on_destroy<SpriteComponent>().connect<&Scene::OnSpriteChanged>(this);
+		mRegistry.on_construct<TransformComponent>().connect<&Scene::OnTransformAdded>(this);
+		mRegistry.on_update<TransformComponent>().connect<&Scene::OnTransformChanged>(this);
+		mRegistry.on_destroy<TransformComponent>().connect<&Scene::OnTransformRemoved>(this);
+		mRegistry.on_construct<RelationshipComponent>().connect<&Scene::OnRelationshipChanged>(this);
+		mRegistry.on_update<RelationshipComponent>().connect<&Scene::OnRelationshipChanged>(this);
+		mRegistry.on_destroy<RelationshipComponent>().connect<&Scene::OnRelationshipChanged>(this);
 	}
 
 	Scene::~Scene()
@@ -145,14 +155,28 @@ namespace rebirth
 		t.tag = tag.empty() ? "Entity" : tag;
 
 		entity.AddComponent<TransformComponent>();
+		entity.AddComponent<RelationshipComponent>();
 		return entity;
 	}
 
 	void Scene::DuplicateEntity(Entity entity)
 	{
-		Entity newEnt = CreateEntity(entity.GetTag());
+		// Parents are copied before their children, so every copied parent is already in the map
+		std::unordered_map<UUID, UUID> copies;
+		for (entt::entity e : GetSubtree(entity))
+		{
+			Entity source = { e, this };
+			Entity newEnt = CreateEntity(source.GetTag());
+
+			CopyComponentIfExists(AllComponents_NoID_NoTag{}, source, newEnt);
+			copies[source.GetUUID()] = newEnt.GetUUID();
 
-		CopyComponentIfExists(AllComponents_NoID_NoTag{}, entity, newEnt);
+			// The copy of the root stays a sibling of the original
+			auto& relationship = newEnt.GetComponent<RelationshipComponent>();
+			auto it = copies.find(relationship.parent);
+			if (it != copies.end())
+				relationship.parent = it->second;
+		}
 
 		//CopyComponentIfExists<TransformComponent>(entity, newEnt);
 		//CopyComponentIfExists<SpriteComponent>(entity, newEnt);
@@ -164,7 +188,44 @@ namespace rebirth
 
 	void Scene::DestroyEntity(Entity entity)
 	{
-		mRegistry.destroy(entity);
+		for (entt::entity e : GetSubtree(entity))
+			mRegistry.destroy(e);
+	}
+
+	void Scene::SetParent(Entity child, Entity parent)
+	{
+		SortHierarchy();
+
+		if (parent)
+		{
+			for (entt::entity e = parent; e != entt::null; e = mRegistry.get<RelationshipComponent>(e).parentHandle)
+			{
+				if (e == (entt::entity)child)
+				{
+					RB_CORE_WARN("Cannot parent {} to itself or one of its children", child.GetTag());
+					return;
+				}
+			}
+		}
+
+		// Work out the local transform that keeps the child's current world placement under the new parent
+		UpdateWorldTransforms();
+		glm::mat4 transform = child.GetComponent<WorldTransformComponent>().transform;
+		if (parent)
+			transform = glm::inverse(parent.GetComponent<WorldTransformComponent>().transform) * transform;
+
+		auto& tc = child.GetComponent<TransformComponent>();
+		Math::Decompose(transform, tc.translation, tc.rotation, tc.scale);
+		child.Patch<TransformComponent>();
+
+		child.GetComponent<RelationshipComponent>().parent = parent ? parent.GetUUID() : UUID(0);
+		child.Patch<RelationshipComponent>();
+	}
+
+	Entity Scene::GetParent(Entity entity)
+	{
+		SortHierarchy();
+		return { entity.GetComponent<RelationshipComponent>().parentHandle, this };
 	}
 
 	void Scene::OnRuntimeStart()
@@ -226,23 +287,25 @@ namespace rebirth
 				transform.translation.x = position.x;
 				transform.translation.y = position.y;
 				transform.rotation.z = body->GetAngle();
+				ent.Patch<TransformComponent>();
 			}
 		}
 
+		UpdateWorldTransforms();
 
 		// Render
 		Camera* camera = nullptr;
 		glm::mat4 transform;
 		{
-			auto view = mRegistry.view<TransformComponent, CameraComponent>();
+			auto view = mRegistry.view<WorldTransformComponent, CameraComponent>();
 
 			for (auto entity : view)
 			{
-				auto [trans, cam] = view.get<TransformComponent, CameraComponent>(entity);
+				auto [world, cam] = view.get<WorldTransformComponent, CameraComponent>(entity);
 				if (cam.primary)
 				{
 					camera = &cam.camera;
-					transform = trans.GetTransform();
+					transform = world.transform;
 					break;
 				}
 
@@ -252,27 +315,7 @@ namespace rebirth
 		if (camera)
 		{
 			Renderer2D::BeginScene(camera->GetProjection(), transform);
-
-			// Sprites
-			{
-				auto group = mRegistry.group<TransformComponent>(entt::get<SpriteComponent>);
-				for (auto entity : group)
-				{
-					auto [trans, sprite] = group.get<TransformComponent, SpriteComponent>(entity);
-					Renderer2D::DrawSprite(trans.GetTransform(), sprite, (int)entity);
-				}
-			}
-
-			// Circles
-			{
-				auto view = mRegistry.view<TransformComponent, CircleComponent>();
-				for (auto entity : view)
-				{
-					auto [trans, circle] = view.get<TransformComponent, CircleComponent>(entity);
-					Renderer2D::DrawCircle(trans.GetTransform(), circle.color, circle.thickness, circle.fade, (int)entity);
-				}
-			}
-
+			DrawRenderables();
 			Renderer2D::EndScene();
 		}
 
@@ -306,6 +349,7 @@ namespace rebirth
 				transform.translation.x = position.x;
 				transform.translation.y = position.y;
 				transform.rotation.z = body->GetAngle();
+				ent.Patch<TransformComponent>();
 			}
 		}
 
@@ -418,31 +462,273 @@ namespace rebirth
 	void Scene::RenderScene(EditorCamera& camera)
 	{
 		RB_PROFILE_FUNC();
+		UpdateWorldTransforms();
 		Renderer2D::BeginScene(camera);
+		DrawRenderables();
+		Renderer2D::EndScene();
+	}
+
+	void Scene::DrawRenderables()
+	{
+		RB_PROFILE_FUNC();
 
-		// Draw sprites
+		// Gathering is cheap, building the vertices is what gets spread across threads.
+		// Sprites and circles are drawn in one call so their layers order them against each other
 		{
-			auto group = mRegistry.group<TransformComponent>(entt::get<SpriteComponent>);
-			for (auto entity : group)
+			mSpriteDrawList.clear();
+			mStaticSpriteDrawList.clear();
+			// Not a group, WorldTransformComponent is kept in hierarchy order instead
+			auto view = mRegistry.view<WorldTransformComponent, SpriteComponent>();
+			for (auto entity : view)
 			{
-				auto [transform, sprite] = group.get<TransformComponent, SpriteComponent>(entity);
+				auto [world, sprite] = view.get<WorldTransformComponent, SpriteComponent>(entity);
+				if (!sprite.isStatic)
+					mSpriteDrawList.push_back({ &world.transform, &sprite, (int)entity });
+				else if (mStaticSpritesDirty)
+					mStaticSpriteDrawList.push_back({ &world.transform, &sprite, (int)entity });
+			}
 
-				Renderer2D::DrawSprite(transform.GetTransform(), sprite, (int)entity);
+			if (mStaticSpritesDirty)
+			{
+				mStaticSprites = Renderer2D::BuildStaticBatch(mStaticSpriteDrawList);
+				mStaticSpritesDirty = false;
 			}
 		}
 
-		// Draw circles
 		{
-			auto view = mRegistry.view<TransformComponent, CircleComponent>();
+			mCircleDrawList.clear();
+			auto view = mRegistry.view<WorldTransformComponent, CircleComponent>();
 			for (auto entity : view)
 			{
-				auto [transform, circle] = view.get<TransformComponent, CircleComponent>(entity);
+				auto [world, circle] = view.get<WorldTransformComponent, CircleComponent>(entity);
+				mCircleDrawList.push_back({ &world.transform, &circle, (int)entity });
+			}
+		}
+
+		Renderer2D::DrawRenderables(mSpriteDrawList, mCircleDrawList, mStaticSprites);
+	}
+
+	void Scene::SortHierarchy()
+	{
+		if (!mHierarchyDirty)
+			return;
+
+		RB_PROFILE_FUNC();
+
+		// Hash lookups only happen here, when the hierarchy changed, never in the per frame pass
+		std::unordered_map<UUID, entt::entity> handles;
+		mRegistry.view<IDComponent>().each([&](auto entity, const IDComponent& id)
+			{
+				handles[id.uuid] = entity;
+			});
 
-				Renderer2D::DrawCircle(transform.GetTransform(), circle.color, circle.thickness, circle.fade, (int)entity);
+		std::vector<entt::entity> roots;
+		std::unordered_map<entt::entity, std::vector<entt::entity>> children;
+		auto view = mRegistry.view<RelationshipComponent>();
+		for (auto entity : view)
+		{
+			auto& relationship = view.get<RelationshipComponent>(entity);
+			entt::entity parent = entt::null;
+			if (relationship.parent != 0)
+			{
+				auto it = handles.find(relationship.parent);
+				if (it != handles.end() && it->second != entity)
+				{
+					parent = it->second;
+				}
+				else
+				{
+					RB_CORE_WARN("Entity {} has a missing parent {}, making it a root", (uint32)entity, (uint64)relationship.parent);
+					relationship.parent = 0;
+				}
 			}
+
+			// A new parent means a new world matrix even if the local transform didn't move
+			if (parent != relationship.parentHandle)
+			{
+				if (auto* world = mRegistry.try_get<WorldTransformComponent>(entity))
+					world->dirty = true;
+			}
+
+			relationship.parentHandle = parent;
+			relationship.order = UINT32_MAX;
+			if (parent == entt::null)
+				roots.push_back(entity);
+			else
+				children[parent].push_back(entity);
 		}
 
-		Renderer2D::EndScene();
+		uint32 order = 0;
+		std::vector<entt::entity> stack;
+		auto visit = [&](entt::entity root)
+		{
+			stack.push_back(root);
+			while (!stack.empty())
+			{
+				entt::entity entity = stack.back();
+				stack.pop_back();
+
+				auto& relationship = view.get<RelationshipComponent>(entity);
+				if (relationship.order != UINT32_MAX)
+					continue;
+
+				relationship.order = order++;
+				relationship.depth = relationship.parentHandle == entt::null ? 0 : view.get<RelationshipComponent>(relationship.parentHandle).depth + 1;
+
+				// Pushed in reverse so siblings keep their order
+				auto it = children.find(entity);
+				if (it != children.end())
+					stack.insert(stack.end(), it->second.rbegin(), it->second.rend());
+			}
+		};
+
+		for (auto root : roots)
+			visit(root);
+
+		// Whatever wasn't reached sits on a parent cycle, which only a hand edited scene file can make
+		for (auto entity : view)
+		{
+			auto& relationship = view.get<RelationshipComponent>(entity);
+			if (relationship.order != UINT32_MAX)
+				continue;
+
+			RB_CORE_WARN("Entity {} is its own ancestor, making it a root", (uint32)entity);
+			relationship.parent = 0;
+			relationship.parentHandle = entt::null;
+			visit(entity);
+		}
+
+		// Every order is taken once, so once sorted an entity's order is its position in the storage
+		for (auto entity : view)
+		{
+			auto& relationship = view.get<RelationshipComponent>(entity);
+			relationship.parentIndex = relationship.parentHandle == entt::null ? UINT32_MAX : view.get<RelationshipComponent>(relationship.parentHandle).order;
+		}
+
+		mRegistry.sort<RelationshipComponent>([](const RelationshipComponent& lhs, const RelationshipComponent& rhs)
+			{
+				return lhs.order < rhs.order;
+			});
+		mRegistry.sort<TransformComponent, RelationshipComponent>();
+		mRegistry.sort<WorldTransformComponent, RelationshipComponent>();
+
+		// Entities shared with the relationships come first in the sorted storages, so equal sizes and
+		// matching entities mean position i is the same entity in all three
+		const entt::sparse_set& relationships = mRegistry.storage<RelationshipComponent>();
+		const entt::sparse_set& locals = mRegistry.storage<TransformComponent>();
+		const entt::sparse_set& worlds = mRegistry.storage<WorldTransformComponent>();
+		mTransformsAligned = locals.size() == relationships.size() && worlds.size() == relationships.size() &&
+			std::equal(relationships.begin(), relationships.end(), locals.begin()) &&
+			std::equal(relationships.begin(), relationships.end(), worlds.begin());
+
+		mHierarchyDirty = false;
+	}
+
+	std::vector<entt::entity> Scene::GetSubtree(entt::entity root)
+	{
+		SortHierarchy();
+
+		// Descendants are the run right after the entity that sits deeper than it
+		std::vector<entt::entity> subtree = { root };
+		auto view = mRegistry.view<RelationshipComponent>();
+		const uint32 depth = view.get<RelationshipComponent>(root).depth;
+		auto it = view.find(root);
+		for (++it; it != view.end() && view.get<RelationshipComponent>(*it).depth > depth; ++it)
+			subtree.push_back(*it);
+
+		return subtree;
+	}
+
+	void Scene::UpdateWorldTransforms()
+	{
+		RB_PROFILE_FUNC();
+		SortHierarchy();
+
+		// Parents come before their children in the sorted storage, so by the time a child is reached
+		// its parent's matrix is final. Comparing nine floats and a version is far cheaper than a rebuild
+		auto update = [this](entt::entity entity, const TransformComponent& local, WorldTransformComponent& world, const WorldTransformComponent* parent)
+		{
+			const uint32 parentVersion = parent ? parent->version : 0;
+			if (!world.dirty && parentVersion == world.parentVersion &&
+				local.translation == world.translation && local.rotation == world.rotation && local.scale == world.scale)
+				return;
+
+			world.transform = parent ? parent->transform * local.GetTransform() : local.GetTransform();
+			world.translation = local.translation;
+			world.rotation = local.rotation;
+			world.scale = local.scale;
+			world.parentVersion = parentVersion;
+			world.version++;
+			world.dirty = false;
+
+			// Also catches static sprites moved by a parent, which never get patched themselves
+			const SpriteComponent* sprite = mRegistry.try_get<SpriteComponent>(entity);
+			if (sprite && sprite->isStatic)
+				mStaticSpritesDirty = true;
+		};
+
+		auto& relationships = mRegistry.storage<RelationshipComponent>();
+		if (mTransformsAligned)
+		{
+			// One linear walk over the three storages, the parent is found by its position
+			auto& locals = mRegistry.storage<TransformComponent>();
+			auto& worlds = mRegistry.storage<WorldTransformComponent>();
+			const entt::sparse_set& entities = relationships;
+
+			auto entity = entities.begin();
+			auto local = locals.begin();
+			auto world = worlds.begin();
+			for (auto relationship = relationships.begin(); relationship != relationships.end(); ++relationship, ++entity, ++local, ++world)
+			{
+				const WorldTransformComponent* parent = relationship->parentIndex != UINT32_MAX ? &worlds.begin()[relationship->parentIndex] : nullptr;
+				update(*entity, *local, *world, parent);
+			}
+			return;
+		}
+
+		// An entity without a transform breaks the shared order, look each one up instead
+		auto view = mRegistry.view<RelationshipComponent>();
+		for (auto entity : view)
+		{
+			const auto& relationship = view.get<RelationshipComponent>(entity);
+			const auto* local = mRegistry.try_get<TransformComponent>(entity);
+			if (!local)
+				continue;
+
+			const WorldTransformComponent* parent = relationship.parentHandle != entt::null ? mRegistry.try_get<WorldTransformComponent>(relationship.parentHandle) : nullptr;
+			update(entity, *local, mRegistry.get<WorldTransformComponent>(entity), parent);
+		}
+	}
+
+	void Scene::OnTransformAdded(entt::registry& registry, entt::entity entity)
+	{
+		// Starts dirty, the next pass builds it. Both storages grew out of hierarchy order
+		registry.emplace_or_replace<WorldTransformComponent>(entity);
+		mHierarchyDirty = true;
+	}
+
+	void Scene::OnTransformRemoved(entt::registry& registry, entt::entity entity)
+	{
+		OnTransformChanged(registry, entity);
+		mHierarchyDirty = true;
+	}
+
+	void Scene::OnRelationshipChanged(entt::registry& registry, entt::entity entity)
+	{
+		mHierarchyDirty = true;
+	}
+
+	void Scene::OnSpriteChanged(entt::registry& registry, entt::entity entity)
+	{
+		// Also covers a sprite that was just switched off static and still sits in the batch
+		mStaticSpritesDirty = true;
+	}
+
+	void Scene::OnTransformChanged(entt::registry& registry, entt::entity entity)
+	{
+		const SpriteComponent* sprite = registry.try_get<SpriteComponent>(entity);
+		if (sprite && sprite->isStatic)
+			mStaticSpritesDirty = true;
 	}
 
 	template<>
@@ -463,6 +749,12 @@ namespace rebirth
 
 	}
 
+	template<>
+	void Scene::OnComponentAdded<RelationshipComponent>(Entity entity, RelationshipComponent& component)
+	{
+
+	}
+
 	template<>
 	void Scene::OnComponentAdded<SpriteComponent>(Entity entity, SpriteComponent& component)
 	{
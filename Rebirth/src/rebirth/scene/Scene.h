@@ -26,6 +26,7 @@
 
 #include "rebirth/core/Timestep.h"
 #include "rebirth/renderer/EditorCamera.h"
+#include "rebirth/renderer/Renderer2D.h"
 #include "rebirth/core/UUID.h"
 
 class b2World;
@@ -45,10 +46,18 @@ namespace rebirth
 		Entity CreateEntity(const std::string& tag = std::string());
 		Entity CreateEntityWithUUID(UUID uuid, const std::string& tag = std::string());
 
+		// Duplicates and destroy take the entity's children with it
 		void DuplicateEntity(Entity entity);
 
 		void DestroyEntity(Entity entity);
 
+		// Keeps the child where it is in the world, an empty parent makes it a root again
+		void SetParent(Entity child, Entity parent);
+		Entity GetParent(Entity entity);
+
+		// Restores the depth first order of the hierarchy if it changed, does nothing otherwise
+		void SortHierarchy();
+
 		void OnRuntimeStart();
 		void OnRuntimeStop();
 
@@ -80,6 +89,20 @@ namespace rebirth
 		void OnPhysics2DStop();
 
 		void RenderScene(EditorCamera& camera);
+		void DrawRenderables();
+
+		// Rebuilds the WorldTransformComponent of every transform that changed since the last pass
+		void UpdateWorldTransforms();
+		void OnTransformAdded(entt::registry& registry, entt::entity entity);
+		void OnRelationshipChanged(entt::registry& registry, entt::entity entity);
+
+		// The entity followed by all of its descendants, parents before children
+		std::vector<entt::entity> GetSubtree(entt::entity root);
+
+		// Registry callbacks, mark the static batch for a rebuild when a baked sprite may have changed
+		void OnSpriteChanged(entt::registry& registry, entt::entity entity);
+		void OnTransformChanged(entt::registry& registry, entt::entity entity);
+		void OnTransformRemoved(entt::registry& registry, entt::entity entity);
 
 		entt::registry mRegistry;
 		uint32 mViewportWidth = 0;
@@ -87,6 +110,20 @@ namespace rebirth
 
 		b2World* mPhysicsWorld = nullptr;
 
+		// Reused every frame so submitting doesn't allocate
+		std::vector<Renderer2D::SpriteDrawItem> mSpriteDrawList;
+		std::vector<Renderer2D::CircleDrawItem> mCircleDrawList;
+
+		// Static sprites are baked once and redrawn until one of them or its transform changes
+		std::vector<Renderer2D::SpriteDrawItem> mStaticSpriteDrawList;
+		Ref<Renderer2D::StaticBatch> mStaticSprites;
+		bool mStaticSpritesDirty = true;
+
+		bool mHierarchyDirty = true;
+		// Every entity with a relationship has a transform and the storages share one order,
+		// so UpdateWorldTransforms can walk them side by side
+		bool mTransformsAligned = false;
+
 		friend class Entity;
 		friend class SceneSerializer;
 		friend class SceneHierarchyPanel; // In Rebirth-Reedit
@@ -28,6 +28,9 @@
 
 #include "Entity.h"
 #include "Components.h"
+#include "rebirth/renderer/Renderer2D.h"
+#include "rebirth/core/Pack.h"
+#include "rebirth/util/PlatformUtil.h"
 
 namespace YAML {
 
@@ -203,6 +206,19 @@ namespace rebirth
 		out << YAML::EndMap; // TransformComponent
 	}
 
+	template<>
+	static void SerializeComponent<RelationshipComponent>(YAML::Emitter& out, Entity entity, const RelationshipComponent& component)
+	{
+		// Roots are the default, only children need the component saved
+		if (component.parent == 0)
+			return;
+
+		out << YAML::Key << "RelationshipComponent";
+		out << YAML::BeginMap; // RelationshipComponent
+		out << YAML::Key << "Parent" << YAML::Value << (uint64)component.parent;
+		out << YAML::EndMap; // RelationshipComponent
+	}
+
 	template<>
 	static void SerializeComponent<CameraComponent>(YAML::Emitter& out, Entity entity, const CameraComponent& component)
 	{
@@ -238,6 +254,8 @@ namespace rebirth
 		if (component.texture)
 			out << YAML::Key << "TexturePath" << YAML::Value << component.texture->GetPath();
 		out << YAML::Key << "TilingFactor" << YAML::Value << component.tilingFactor;
+		out << YAML::Key << "Layer" << YAML::Value << component.layer;
+		out << YAML::Key << "Static" << YAML::Value << component.isStatic;
 
 		out << YAML::EndMap; // SpriteComponent
 	}
@@ -251,6 +269,7 @@ namespace rebirth
 		out << YAML::Key << "Color" << YAML::Value << component.color;
 		out << YAML::Key << "Thickness" << YAML::Value << component.thickness;
 		out << YAML::Key << "Fade" << YAML::Value << component.fade;
+		out << YAML::Key << "Layer" << YAML::Value << component.layer;
 
 		out << YAML::EndMap; // CircleComponent
 	}
@@ -347,6 +366,12 @@ namespace rebirth
 		component.scale = node["Scale"].as<glm::vec3>();
 	}
 
+	template<>
+	static void DeserializeComponent<RelationshipComponent>(YAML::Node node, RelationshipComponent& component)
+	{
+		component.parent = node["Parent"].as<uint64>();
+	}
+
 	template<>
 	static void DeserializeComponent<CameraComponent>(YAML::Node node, CameraComponent& component)
 	{
@@ -367,9 +392,16 @@ namespace rebirth
 	{
 		component.color = node["Color"].as<glm::vec4>();
 		if (node["TexturePath"])
-			component.texture = Texture2D::Create(node["TexturePath"].as<std::string>());
+		{
+			component.texture = Texture2D::CreateAsync(node["TexturePath"].as<std::string>());
+			component.subTexture = Renderer2D::GetTextureAtlas().Pack(component.texture);
+		}
 		if (node["TilingFactor"])
 			component.tilingFactor = node["TilingFactor"].as<float>();
+		if (node["Layer"])
+			component.layer = node["Layer"].as<int32>();
+		if (node["Static"])
+			component.isStatic = node["Static"].as<bool>();
 	}
 
 	template<>
@@ -378,6 +410,8 @@ namespace rebirth
 		component.color = node["Color"].as<glm::vec4>();
 		component.thickness = node["Thickness"].as<float>();
 		component.fade = node["Fade"].as<float>();
+		if (node["Layer"])
+			component.layer = node["Layer"].as<int32>();
 	}
 
 	template<>
@@ -409,6 +443,371 @@ namespace rebirth
 		component.restitutionThreshold = node["RestitutionThreshold"].as<float>();
 	}
 
+	// Binary scenes
+
+	// "RBSC"
+	static constexpr uint32 sSceneMagic = 0x43534252;
+
+	class SceneWriter
+	{
+	public:
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be written as raw bytes");
+			const byte* bytes = (const byte*)&value;
+			mData.insert(mData.end(), bytes, bytes + sizeof(T));
+		}
+
+		void WriteString(const std::string& str)
+		{
+			Write((uint32)str.size());
+			mData.insert(mData.end(), str.begin(), str.end());
+		}
+
+		// Writes a placeholder that Patch fills in once the value is known
+		template<typename T>
+		size_t Reserve()
+		{
+			size_t offset = mData.size();
+			Write(T{});
+			return offset;
+		}
+
+		template<typename T>
+		void Patch(const size_t offset, const T& value)
+		{
+			memcpy(mData.data() + offset, &value, sizeof(T));
+		}
+
+		const std::vector<byte>& GetData() const { return mData; }
+
+	private:
+		std::vector<byte> mData;
+	};
+
+	// Reads past the end fail rather than assert, a truncated file is reported once at the end
+	class SceneReader
+	{
+	public:
+		SceneReader(const byte* data, const uint64 size) : mData(data), mSize(size) {}
+
+		template<typename T>
+		bool Read(T& outValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be read as raw bytes");
+			if (mFailed || mSize - mOffset < sizeof(T))
+			{
+				mFailed = true;
+				return false;
+			}
+
+			memcpy(&outValue, mData + mOffset, sizeof(T));
+			mOffset += sizeof(T);
+			return true;
+		}
+
+		bool ReadString(std::string& outStr)
+		{
+			uint32 size = 0;
+			if (!Read(size) || mSize - mOffset < size)
+			{
+				mFailed = true;
+				return false;
+			}
+
+			outStr.assign((const char*)mData + mOffset, size);
+			mOffset += size;
+			return true;
+		}
+
+		bool HasFailed() const { return mFailed; }
+
+	private:
+		const byte* mData;
+		uint64 mSize;
+		uint64 mOffset = 0;
+		bool mFailed = false;
+	};
+
+	// Returns false for components that aren't saved, those write nothing
+	template<typename C>
+	static bool WriteComponent(SceneWriter& out, const C& component) { return false; }
+
+	template<typename C>
+	static void ReadComponent(SceneReader& in, C& component) {}
+
+	template<>
+	static bool WriteComponent<TransformComponent>(SceneWriter& out, const TransformComponent& component)
+	{
+		out.Write(component.translation);
+		out.Write(component.rotation);
+		out.Write(component.scale);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<TransformComponent>(SceneReader& in, TransformComponent& component)
+	{
+		in.Read(component.translation);
+		in.Read(component.rotation);
+		in.Read(component.scale);
+	}
+
+	template<>
+	static bool WriteComponent<RelationshipComponent>(SceneWriter& out, const RelationshipComponent& component)
+	{
+		if (component.parent == 0)
+			return false;
+
+		out.Write((uint64)component.parent);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<RelationshipComponent>(SceneReader& in, RelationshipComponent& component)
+	{
+		uint64 parent = 0;
+		in.Read(parent);
+		component.parent = parent;
+	}
+
+	template<>
+	static bool WriteComponent<CameraComponent>(SceneWriter& out, const CameraComponent& component)
+	{
+		const SceneCamera& camera = component.camera;
+		out.Write((uint32)camera.GetProjectionType());
+		out.Write(camera.GetPerspectiveFoV());
+		out.Write(camera.GetPerspectiveNearClip());
+		out.Write(camera.GetPerspectiveFarClip());
+		out.Write(camera.GetOrthographicSize());
+		out.Write(camera.GetOrthographicNearClip());
+		out.Write(camera.GetOrthographicFarClip());
+		out.Write(component.primary);
+		out.Write(component.fixedAspectRatio);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<CameraComponent>(SceneReader& in, CameraComponent& component)
+	{
+		uint32 projectionType = 0;
+		float perspective[3] = {};
+		float orthographic[3] = {};
+		in.Read(projectionType);
+		in.Read(perspective);
+		in.Read(orthographic);
+		in.Read(component.primary);
+		in.Read(component.fixedAspectRatio);
+
+		component.camera.SetProjectionType((SceneCamera::ProjectionType)projectionType);
+		component.camera.SetPerspectiveFoV(perspective[0]);
+		component.camera.SetPerspectiveNearClip(perspective[1]);
+		component.camera.SetPerspectiveFarClip(perspective[2]);
+		component.camera.SetOrthographicSize(orthographic[0]);
+		component.camera.SetOrthographicNearClip(orthographic[1]);
+		component.camera.SetOrthographicFarClip(orthographic[2]);
+	}
+
+	// Cooking sprites never loads their texture, so both paths write the record through here
+	static void WriteSprite(SceneWriter& out, const glm::vec4& color, const std::string& texturePath, const float tilingFactor, const int32 layer, const bool isStatic)
+	{
+		out.Write(color);
+		out.WriteString(texturePath);
+		out.Write(tilingFactor);
+		out.Write(layer);
+		out.Write(isStatic);
+	}
+
+	template<>
+	static bool WriteComponent<SpriteComponent>(SceneWriter& out, const SpriteComponent& component)
+	{
+		WriteSprite(out, component.color, component.texture ? component.texture->GetPath() : std::string(), component.tilingFactor, component.layer, component.isStatic);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<SpriteComponent>(SceneReader& in, SpriteComponent& component)
+	{
+		std::string texturePath;
+		in.Read(component.color);
+		in.ReadString(texturePath);
+		in.Read(component.tilingFactor);
+		in.Read(component.layer);
+		in.Read(component.isStatic);
+
+		if (!texturePath.empty() && !in.HasFailed())
+		{
+			component.texture = Texture2D::CreateAsync(texturePath);
+			component.subTexture = Renderer2D::GetTextureAtlas().Pack(component.texture);
+		}
+	}
+
+	template<>
+	static bool WriteComponent<CircleComponent>(SceneWriter& out, const CircleComponent& component)
+	{
+		out.Write(component.color);
+		out.Write(component.thickness);
+		out.Write(component.fade);
+		out.Write(component.layer);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<CircleComponent>(SceneReader& in, CircleComponent& component)
+	{
+		in.Read(component.color);
+		in.Read(component.thickness);
+		in.Read(component.fade);
+		in.Read(component.layer);
+	}
+
+	template<>
+	static bool WriteComponent<RigidBody2DComponent>(SceneWriter& out, const RigidBody2DComponent& component)
+	{
+		out.Write((uint32)component.bodyType);
+		out.Write(component.fixedRotation);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<RigidBody2DComponent>(SceneReader& in, RigidBody2DComponent& component)
+	{
+		uint32 bodyType = 0;
+		in.Read(bodyType);
+		in.Read(component.fixedRotation);
+		component.bodyType = (RigidBody2DComponent::BodyType)bodyType;
+	}
+
+	template<>
+	static bool WriteComponent<BoxCollider2DComponent>(SceneWriter& out, const BoxCollider2DComponent& component)
+	{
+		out.Write(component.offset);
+		out.Write(component.size);
+		out.Write(component.density);
+		out.Write(component.friction);
+		out.Write(component.restitution);
+		out.Write(component.restitutionThreshold);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<BoxCollider2DComponent>(SceneReader& in, BoxCollider2DComponent& component)
+	{
+		in.Read(component.offset);
+		in.Read(component.size);
+		in.Read(component.density);
+		in.Read(component.friction);
+		in.Read(component.restitution);
+		in.Read(component.restitutionThreshold);
+	}
+
+	template<>
+	static bool WriteComponent<CircleCollider2DComponent>(SceneWriter& out, const CircleCollider2DComponent& component)
+	{
+		out.Write(component.offset);
+		out.Write(component.radius);
+		out.Write(component.density);
+		out.Write(component.friction);
+		out.Write(component.restitution);
+		out.Write(component.restitutionThreshold);
+		return true;
+	}
+
+	template<>
+	static void ReadComponent<CircleCollider2DComponent>(SceneReader& in, CircleCollider2DComponent& component)
+	{
+		in.Read(component.offset);
+		in.Read(component.radius);
+		in.Read(component.density);
+		in.Read(component.friction);
+		in.Read(component.restitution);
+		in.Read(component.restitutionThreshold);
+	}
+
+	// One bit per type of the group, in group order, then the records of the set bits
+	template<typename... T>
+	static void WriteAllComponents(ComponentGroup<T...>, SceneWriter& out, Entity entity)
+	{
+		const size_t maskOffset = out.Reserve<uint32>();
+		uint32 mask = 0;
+		uint32 bit = 0;
+		([&]()
+			{
+				if (entity.HasComponent<T>() && WriteComponent<T>(out, entity.GetComponent<T>()))
+					mask |= 1u << bit;
+				bit++;
+			}(), ...);
+		out.Patch(maskOffset, mask);
+	}
+
+	template<typename... T>
+	static void ReadAllComponents(ComponentGroup<T...>, SceneReader& in, Entity entity)
+	{
+		uint32 mask = 0;
+		in.Read(mask);
+		uint32 bit = 0;
+		([&]()
+			{
+				if ((mask & (1u << bit)) && !in.HasFailed())
+				{
+					auto& component = entity.HasComponent<T>() ? entity.GetComponent<T>() : entity.AddComponent<T>();
+					ReadComponent<T>(in, component);
+				}
+				bit++;
+			}(), ...);
+	}
+
+	// Goes through the yaml components rather than a scene, so cooking needs no renderer
+	template<typename C>
+	static bool CookComponent(YAML::Node node, SceneWriter& out)
+	{
+		C component{};
+		DeserializeComponent<C>(node, component);
+		return WriteComponent<C>(out, component);
+	}
+
+	template<>
+	static bool CookComponent<SpriteComponent>(YAML::Node node, SceneWriter& out)
+	{
+		SpriteComponent defaults;
+		WriteSprite(out, node["Color"].as<glm::vec4>(),
+			node["TexturePath"] ? node["TexturePath"].as<std::string>() : std::string(),
+			node["TilingFactor"] ? node["TilingFactor"].as<float>() : defaults.tilingFactor,
+			node["Layer"] ? node["Layer"].as<int32>() : defaults.layer,
+			node["Static"] ? node["Static"].as<bool>() : defaults.isStatic);
+		return true;
+	}
+
+	template<typename... T>
+	static void CookAllComponents(ComponentGroup<T...>, YAML::detail::iterator_value entity, SceneWriter& out)
+	{
+		const size_t maskOffset = out.Reserve<uint32>();
+		uint32 mask = 0;
+		uint32 bit = 0;
+		([&]()
+			{
+				T temp{};
+				auto node = entity[temp.name];
+				if (node && CookComponent<T>(node, out))
+					mask |= 1u << bit;
+				bit++;
+			}(), ...);
+		out.Patch(maskOffset, mask);
+	}
+
+	static bool WriteScene(const std::string& filepath, const SceneWriter& out)
+	{
+		std::ofstream stream(filepath, std::ios::out | std::ios::binary);
+		stream.write((const char*)out.GetData().data(), out.GetData().size());
+		if (!stream)
+		{
+			RB_CORE_ERROR("Failed to write scene file {}", filepath);
+			return false;
+		}
+		return true;
+	}
+
 	SceneSerializer::SceneSerializer(const Ref<Scene>& scene) : mScene(scene)
 	{
 
@@ -448,18 +847,50 @@ namespace rebirth
 
 	void SceneSerializer::SerializeToBinary(const std::string& filepath)
 	{
-		RB_CORE_ASSERT(false, "Not yet implemented");
+		RB_PROFILE_FUNC();
+		RB_CORE_TRACE("Serializing scene to {}", filepath);
+		SceneWriter out;
+		out.Write(sSceneMagic);
+		out.Write(BINARY_VERSION);
+		out.WriteString("Untitled");
+		const size_t countOffset = out.Reserve<uint32>();
+
+		uint32 count = 0;
+		mScene->mRegistry.each([&](auto entId)
+			{
+				Entity entity = { entId, mScene.get() };
+				if (!entity) return;
+
+				RB_CORE_ASSERT(entity.HasComponent<IDComponent>(), "Entities must have a UUID IDComponent");
+				out.Write((uint64)entity.GetUUID());
+				out.WriteString(entity.HasComponent<TagComponent>() ? entity.GetComponent<TagComponent>().tag : std::string());
+				WriteAllComponents(AllComponents_NoID_NoTag{}, out, entity);
+				count++;
+			});
+		out.Patch(countOffset, count);
+
+		WriteScene(filepath, out);
 	}
 
 	bool SceneSerializer::DeserializeFromYaml(const std::string& filepath)
 	{
-		std::ifstream stream(filepath);
-		std::stringstream strStream;
-		strStream << stream.rdbuf();
+		std::string source;
+		PackView view;
+		if (Pack::Read(filepath, view))
+		{
+			source = view.AsString();
+		}
+		else
+		{
+			std::ifstream stream(filepath);
+			std::stringstream strStream;
+			strStream << stream.rdbuf();
+			source = strStream.str();
+		}
 
 		YAML::Node data;
 		try {
-			data = YAML::Load(strStream.str());
+			data = YAML::Load(source);
 		}
 		catch (YAML::ParserException e)
 		{
@@ -500,8 +931,130 @@ namespace rebirth
 
 	bool SceneSerializer::DeserializeFromBinary(const std::string& filepath)
 	{
-		RB_CORE_ASSERT(false, "Not yet implemented");
-		return false;
+		RB_PROFILE_FUNC();
+
+		PackView view;
+		MappedFile file;
+		if (!Pack::Read(filepath, view) && !file.Open(filepath))
+		{
+			RB_CORE_ERROR("Failed to open scene file {}", filepath);
+			return false;
+		}
+
+		SceneReader in(file.IsOpen() ? file.GetData() : view.GetData(), file.IsOpen() ? file.GetSize() : view.GetSize());
+		uint32 magic = 0;
+		uint32 version = 0;
+		in.Read(magic);
+		in.Read(version);
+		if (magic != sSceneMagic || version != BINARY_VERSION)
+		{
+			RB_CORE_ERROR("{} is not a binary scene of version {}", filepath, BINARY_VERSION);
+			return false;
+		}
+
+		std::string sceneName;
+		uint32 count = 0;
+		in.ReadString(sceneName);
+		in.Read(count);
+		RB_CORE_INFO("Deserializing scene '{}'", sceneName);
+
+		std::vector<entt::entity> created;
+		for (uint32 i = 0; i < count && !in.HasFailed(); i++)
+		{
+			uint64 uuid = 0;
+			std::string name;
+			in.Read(uuid);
+			in.ReadString(name);
+
+			Entity entity = mScene->CreateEntityWithUUID(uuid, name);
+			ReadAllComponents(AllComponents_NoID_NoTag{}, in, entity);
+			created.push_back(entity);
+		}
+
+		if (in.HasFailed())
+		{
+			// Nothing half loaded stays behind, Deserialize falls back to the yaml with the same UUIDs
+			RB_CORE_ERROR("Scene file {} is truncated", filepath);
+			mScene->mRegistry.destroy(created.begin(), created.end());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SceneSerializer::Deserialize(const std::string& filepath)
+	{
+		std::string cooked = FindCooked(filepath);
+		if (!cooked.empty() && DeserializeFromBinary(cooked))
+			return true;
+
+		return DeserializeFromYaml(filepath);
+	}
+
+	bool SceneSerializer::Cook(const std::string& source, const std::string& output)
+	{
+		RB_PROFILE_FUNC();
+
+		SceneWriter out;
+		try {
+			YAML::Node data = YAML::LoadFile(source);
+			if (!data["Scene"])
+			{
+				RB_CORE_ERROR("Scene file {} does not contain Scene node", source);
+				return false;
+			}
+
+			out.Write(sSceneMagic);
+			out.Write(BINARY_VERSION);
+			out.WriteString(data["Scene"].as<std::string>());
+			const size_t countOffset = out.Reserve<uint32>();
+
+			uint32 count = 0;
+			auto entities = data["Entities"];
+			if (entities)
+			{
+				for (auto entity : entities)
+				{
+					auto tagComponent = entity["TagComponent"];
+					out.Write(entity["Entity"].as<uint64>());
+					out.WriteString(tagComponent ? tagComponent["Tag"].as<std::string>() : std::string());
+					CookAllComponents(AllComponents_NoID_NoTag{}, entity, out);
+					count++;
+				}
+			}
+			out.Patch(countOffset, count);
+		}
+		catch (YAML::Exception e)
+		{
+			RB_CORE_ERROR("Failed to load scene file {}", source);
+			return false;
+		}
+
+		return WriteScene(output, out);
+	}
+
+	std::string SceneSerializer::FindCooked(const std::string& source)
+	{
+		std::string cooked = GetCookedPath(source);
+		if (Pack::Exists(cooked))
+			return cooked;
+
+		std::error_code error;
+		auto cookedTime = std::filesystem::last_write_time(cooked, error);
+		if (error)
+			return std::string();
+
+		// Saving the scene in the editor makes the yaml newer, so edits are never shadowed
+		auto sourceTime = std::filesystem::last_write_time(source, error);
+		if (!error && sourceTime > cookedTime)
+			return std::string();
+
+		return cooked;
+	}
+
+	std::string SceneSerializer::GetCookedPath(const std::string& source)
+	{
+		return source + COOKED_EXTENSION;
 	}
 
 }
\ No newline at end of file
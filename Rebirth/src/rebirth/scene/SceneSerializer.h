@@ -29,6 +29,11 @@ namespace rebirth
 	class SceneSerializer
 	{
 	public:
+		// Binary scenes cooked from the yaml, loaded in its place by Deserialize
+		static constexpr const char* COOKED_EXTENSION = ".rbscene";
+		// Bump whenever a component record or AllComponents_NoID_NoTag changes, Rebirth-Cook recooks every scene then
+		static constexpr uint32 BINARY_VERSION = 2;
+
 		SceneSerializer(const Ref<Scene>& scene);
 
 		void SerializeToYaml(const std::string& filepath);
@@ -36,6 +41,16 @@ namespace rebirth
 
 		bool DeserializeFromYaml(const std::string& filepath);
 		bool DeserializeFromBinary(const std::string& filepath);
+
+		// The cooked scene if it's up to date, otherwise the yaml
+		bool Deserialize(const std::string& filepath);
+
+		// Converts the yaml to the binary format without loading any of its textures
+		static bool Cook(const std::string& source, const std::string& output);
+
+		// The binary scene to load in place of the yaml, empty if it wasn't cooked or is older than the yaml
+		static std::string FindCooked(const std::string& source);
+		static std::string GetCookedPath(const std::string& source);
 	private:
 		Ref<Scene> mScene;
 	};
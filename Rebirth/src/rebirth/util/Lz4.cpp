@@ -0,0 +1,200 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Lz4.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "rbpch.h"
+#include "Lz4.h"
+
+namespace rebirth
+{
+	static constexpr uint32 sMinMatch = 4;
+	// The format requires the last 5 bytes to be literals and the last match to start 12 bytes before the end
+	static constexpr uint32 sLastLiterals = 5;
+	static constexpr uint32 sMatchSearchLimit = 12;
+	static constexpr uint32 sMaxOffset = 65535;
+	static constexpr uint32 sHashBits = 16;
+
+	static uint32 Read32(const byte* data)
+	{
+		uint32 value;
+		memcpy(&value, data, sizeof(uint32));
+		return value;
+	}
+
+	static uint32 Hash(const uint32 sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - sHashBits);
+	}
+
+	static bool WriteLength(byte* dst, uint32& out, const uint32 capacity, uint32 length)
+	{
+		while (length >= 255)
+		{
+			if (out >= capacity)
+				return false;
+			dst[out++] = 255;
+			length -= 255;
+		}
+
+		if (out >= capacity)
+			return false;
+		dst[out++] = (byte)length;
+		return true;
+	}
+
+	// Literals followed by a match, or just literals when matchLength is 0 for the last sequence
+	static bool WriteSequence(byte* dst, uint32& out, const uint32 capacity, const byte* literals, const uint32 literalLength, const uint32 offset, const uint32 matchLength)
+	{
+		if (out >= capacity)
+			return false;
+
+		const uint32 matchCode = matchLength ? matchLength - sMinMatch : 0;
+		dst[out++] = (byte)((std::min(literalLength, 15u) << 4) | std::min(matchCode, 15u));
+		if (literalLength >= 15 && !WriteLength(dst, out, capacity, literalLength - 15))
+			return false;
+
+		if (literalLength > capacity - out)
+			return false;
+		memcpy(dst + out, literals, literalLength);
+		out += literalLength;
+
+		if (!matchLength)
+			return true;
+
+		if (capacity - out < 2)
+			return false;
+		dst[out++] = (byte)offset;
+		dst[out++] = (byte)(offset >> 8);
+
+		return matchCode < 15 || WriteLength(dst, out, capacity, matchCode - 15);
+	}
+
+	uint32 Lz4::Compress(const byte* src, const uint32 size, byte* dst, const uint32 capacity)
+	{
+		RB_PROFILE_FUNC();
+
+		uint32 out = 0;
+		uint32 anchor = 0;
+		if (size >= sMatchSearchLimit)
+		{
+			std::vector<int32> table((size_t)1 << sHashBits, -1);
+			const uint32 matchEnd = size - sLastLiterals;
+			const uint32 searchEnd = size - sMatchSearchLimit;
+
+			uint32 pos = 0;
+			while (pos <= searchEnd)
+			{
+				const uint32 sequence = Read32(src + pos);
+				const uint32 hash = Hash(sequence);
+				const int32 candidate = table[hash];
+				table[hash] = (int32)pos;
+
+				if (candidate < 0 || pos - (uint32)candidate > sMaxOffset || Read32(src + candidate) != sequence)
+				{
+					pos++;
+					continue;
+				}
+
+				uint32 matchLength = sMinMatch;
+				while (pos + matchLength < matchEnd && src[candidate + matchLength] == src[pos + matchLength])
+					matchLength++;
+
+				if (!WriteSequence(dst, out, capacity, src + anchor, pos - anchor, pos - (uint32)candidate, matchLength))
+					return 0;
+
+				pos += matchLength;
+				anchor = pos;
+			}
+		}
+
+		if (!WriteSequence(dst, out, capacity, src + anchor, size - anchor, 0, 0))
+			return 0;
+
+		return out;
+	}
+
+	bool Lz4::Decompress(const byte* src, const uint32 srcSize, byte* dst, const uint32 dstSize)
+	{
+		RB_PROFILE_FUNC();
+
+		uint32 in = 0;
+		uint32 out = 0;
+		while (in < srcSize)
+		{
+			const byte token = src[in++];
+
+			uint32 literalLength = token >> 4;
+			if (literalLength == 15)
+			{
+				byte extra;
+				do
+				{
+					if (in >= srcSize)
+						return false;
+					extra = src[in++];
+					literalLength += extra;
+				} while (extra == 255);
+			}
+
+			if (literalLength > srcSize - in || literalLength > dstSize - out)
+				return false;
+			memcpy(dst + out, src + in, literalLength);
+			in += literalLength;
+			out += literalLength;
+
+			// The last sequence has no match
+			if (in == srcSize)
+				break;
+
+			if (srcSize - in < 2)
+				return false;
+			const uint32 offset = src[in] | (src[in + 1] << 8);
+			in += 2;
+			if (offset == 0 || offset > out)
+				return false;
+
+			uint32 matchLength = token & 15;
+			if (matchLength == 15)
+			{
+				byte extra;
+				do
+				{
+					if (in >= srcSize)
+						return false;
+					extra = src[in++];
+					matchLength += extra;
+				} while (extra == 255);
+			}
+			matchLength += sMinMatch;
+
+			if (matchLength > dstSize - out)
+				return false;
+
+			// Matches can overlap what they produce, so this copies forward a byte at a time
+			const byte* match = dst + out - offset;
+			for (uint32 i = 0; i < matchLength; i++)
+				dst[out + i] = match[i];
+			out += matchLength;
+		}
+
+		return out == dstSize;
+	}
+}
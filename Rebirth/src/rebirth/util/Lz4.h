@@ -0,0 +1,40 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: Lz4.h
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#pragma once
+
+namespace rebirth
+{
+	// LZ4 block format, compatible with LZ4_compress_default / LZ4_decompress_safe.
+	// The compressor is the plain greedy single probe one, it favours speed over ratio
+	class Lz4
+	{
+	public:
+		static uint32 GetMaxCompressedSize(uint32 size) { return size + size / 255 + 16; }
+
+		// Returns the compressed size, 0 if it doesn't fit in capacity
+		static uint32 Compress(const byte* src, uint32 size, byte* dst, uint32 capacity);
+
+		// False unless the block is valid and decompresses to exactly dstSize bytes
+		static bool Decompress(const byte* src, uint32 srcSize, byte* dst, uint32 dstSize);
+	};
+}
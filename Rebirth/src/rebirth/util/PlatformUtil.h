@@ -43,4 +43,28 @@ namespace rebirth
 		static double GetTime();
 	};
 
+	// Read only mapping of a whole file, unmapped when closed or destroyed
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const { return mData != nullptr; }
+		const byte* GetData() const { return mData; }
+		uint64 GetSize() const { return mSize; }
+
+	private:
+		const byte* mData = nullptr;
+		uint64 mSize = 0;
+		void* mFile = nullptr;
+		void* mMapping = nullptr;
+	};
+
 }
@@ -1,10 +1,13 @@
 #type vertex
-#version 330 core
+#version 450 core
 
 layout(location=0) in vec3 aPos;
 
-uniform mat4 uViewProj;
-uniform mat4 uModelTransform;
+layout(std140, binding = 1) uniform Transform
+{
+	mat4 uViewProj;
+	mat4 uModelTransform;
+};
 
 out vec3 vPos;
 
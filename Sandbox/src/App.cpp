@@ -26,6 +26,7 @@
 
 //#include "SampleLayer.h"
 #include "Sandbox2D.h"
+#include "SortBenchmark.h"
 
 
 class Sandbox final : public rebirth::Application
@@ -35,6 +36,15 @@ public:
 	{
 		//PushLayer(new SampleLayer());
 		PushLayer(new Sandbox2D());
+
+		for (int i = 1; i < args.count; i++)
+		{
+			if (std::strcmp(args[i], "--sort-benchmark") == 0)
+			{
+				RunSortBenchmark();
+				Close();
+			}
+		}
 	}
 	~Sandbox() override = default;
 
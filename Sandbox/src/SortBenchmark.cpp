@@ -0,0 +1,93 @@
+// ------------------------------------------------------------------------------
+// 
+// Rebirth
+//    Copyright 2022 Matthew Rogers
+// 
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+// 
+//        http://www.apache.org/licenses/LICENSE-2.0
+// 
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+// 
+// File Name: SortBenchmark.cpp
+// Date File Created: 10/18/2026
+// Author: Matt
+// 
+// ------------------------------------------------------------------------------
+#include "SortBenchmark.h"
+
+#include <Rebirth.h>
+
+#include <chrono>
+#include <limits>
+#include <random>
+
+using rebirth::SortItem;
+using rebirth::SortKey;
+
+// Roughly what a scene submits: a few layers, spread out depths and a small texture set
+static std::vector<SortItem> MakeItems(uint32_t count, std::mt19937& rng)
+{
+	std::uniform_int_distribution<int32_t> layer(-2, 2);
+	std::uniform_real_distribution<float> depth(-10.0f, 10.0f);
+	std::uniform_int_distribution<uint32_t> texture(1, 64);
+
+	std::vector<SortItem> items(count);
+	for (uint32_t i = 0; i < count; i++)
+		items[i] = { SortKey::Make(layer(rng), depth(rng), 0, texture(rng)), i };
+	return items;
+}
+
+template<typename Fn>
+static double TimeBest(const std::vector<SortItem>& input, std::vector<SortItem>& output, const Fn& sort)
+{
+	constexpr int runs = 10;
+	double best = std::numeric_limits<double>::max();
+	for (int run = 0; run < runs; run++)
+	{
+		output = input;
+		auto start = std::chrono::high_resolution_clock::now();
+		sort(output);
+		auto end = std::chrono::high_resolution_clock::now();
+		best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+	}
+	return best;
+}
+
+void RunSortBenchmark()
+{
+	auto byKey = [](const SortItem& a, const SortItem& b) { return a.key < b.key; };
+	auto sameOrder = [](const std::vector<SortItem>& a, const std::vector<SortItem>& b)
+	{
+		return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+			[](const SortItem& x, const SortItem& y) { return x.key == y.key && x.index == y.index; });
+	};
+	auto sameKeys = [](const std::vector<SortItem>& a, const std::vector<SortItem>& b)
+	{
+		return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+			[](const SortItem& x, const SortItem& y) { return x.key == y.key; });
+	};
+
+	std::mt19937 rng(1337);
+	for (uint32_t count : { 100000u, 250000u, 1000000u })
+	{
+		std::vector<SortItem> input = MakeItems(count, rng);
+		std::vector<SortItem> radix, stable, unstable, scratch;
+
+		double radixMs = TimeBest(input, radix, [&](std::vector<SortItem>& items) { SortKey::RadixSort(items, scratch); });
+		double stableMs = TimeBest(input, stable, [&](std::vector<SortItem>& items) { std::stable_sort(items.begin(), items.end(), byKey); });
+		double sortMs = TimeBest(input, unstable, [&](std::vector<SortItem>& items) { std::sort(items.begin(), items.end(), byKey); });
+
+		// The radix sort is stable, it has to match std::stable_sort exactly.
+		// std::sort may reorder equal keys, so only its key sequence is compared
+		const bool matches = sameOrder(radix, stable) && sameKeys(radix, unstable);
+		RB_CLIENT_INFO("{} keys: radix {:.3f} ms, std::stable_sort {:.3f} ms, std::sort {:.3f} ms ({})",
+			count, radixMs, stableMs, sortMs, matches ? "orders match" : "ORDERS DIFFER");
+	}
+}
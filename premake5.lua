@@ -41,6 +41,13 @@ group "Dependencies"
 	include "vendor/deps/box2d"
 group ""
 
+group "Tools"
+	include "Rebirth-Cook"
+	include "Rebirth-ShaderCook"
+	include "Rebirth-TextureCook"
+	include "Rebirth-Pack"
+group ""
+
 include "Rebirth"
 include "Rebirth-Reedit"
 include "Sandbox"
\ No newline at end of file